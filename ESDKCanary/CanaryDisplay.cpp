@@ -1,175 +1,714 @@
 #include "CanaryDisplay.h"
 
+// Layouts are display lists: one item per line of text, each drawn
+// into a band and run down the panel in list order. Bands overlap, so
+// each item only owns the rows that the next band down does not cover.
+// Only those rows are ever sent, which lets items be updated
+// independently. Static items (the labels) go out with the values when
+// the screen is entered, so the first partial refresh draws them over
+// the last scene. Once it is done they are written to both RAM planes
+// and never resent.
+//
+// The tables are constexpr: the owned rows are worked out by the
+// compiler and checked against the band order below, so nothing about
+// a layout is computed at run time.
+
+// Where an item's text comes from
+enum DisplaySource : uint8_t {
+  SRC_TEXT,         // the item's text as is
+  SRC_CO2,          // ESDKCanary members, formatted as a number
+  SRC_TEMPERATURE,
+  SRC_HUMIDITY,
+  SRC_TVOC,
+  SRC_PM,
+  SRC_MODE          // Wifi/Audio/Demo line
+};
+
+struct DisplayRows {
+  int16_t y;        // band origin on the panel
+  int16_t y0;       // panel rows the band owns
+  int16_t y1;
+};
+
+struct DisplayItem {
+  DisplayRows rows;
+  uint8_t x;        // text origin inside the band
+  uint8_t textY;
+  sFONT* font;
+  uint8_t scale;
+  uint8_t source;
+  uint8_t digits;   // zero padded digits before the point
+  uint8_t decimals; // digits after it, 0 for none
+  const char* text; // fixed text, or the unit after a number
+  bool isStatic;
+};
+
+struct DisplayList {
+  const DisplayItem* items;
+  int count;
+  int bandHeight;
+};
+
+#define NO_BAND -1
+
+// Rows owned by a band at y when the next band down the list is at below
+static constexpr DisplayRows bandRows(int y, int below, int height) {
+  return DisplayRows{
+    (int16_t)y,
+    (int16_t)(below != NO_BAND && below + height > y ? below + height : y),
+    (int16_t)(y + height - 1 > EPD_HEIGHT - 1 ? EPD_HEIGHT - 1 : y + height - 1)
+  };
+}
+
+static constexpr bool rowsMatch(const DisplayItem* items, int count, int height, int i) {
+  return i >= count ||
+         (items[i].rows.y0 == bandRows(items[i].rows.y, i + 1 < count ? items[i + 1].rows.y : NO_BAND, height).y0 &&
+          rowsMatch(items, count, height, i + 1));
+}
+
+#define ROWS(y, below) bandRows(y, below, BAND_HEIGHT)
+#define LABEL(y, below, textY, font, text) {ROWS(y, below), 0, textY, font, 1, SRC_TEXT, 0, 0, text, true}
+#define NUMBER(y, below, textY, font, scale, source, digits, decimals, unit) \
+  {ROWS(y, below), 0, textY, font, scale, source, digits, decimals, unit, false}
+
+static constexpr DisplayItem READINGS_ITEMS[] = {
+  LABEL(250, 230, 4, &Font24_Rot180, "CO2"),
+  NUMBER(230, 200, 4, &Font20_Rot180, 1, SRC_CO2, 4, 0, "ppm"),
+  LABEL(200, 180, 4, &Font24_Rot180, "TEMP"),
+  NUMBER(180, 150, 4, &Font20_Rot180, 1, SRC_TEMPERATURE, 2, 1, "C"),
+  LABEL(150, 130, 0, &Font24_Rot180, "RH"),
+  NUMBER(130, 100, 0, &Font20_Rot180, 1, SRC_HUMIDITY, 2, 1, "%"),
+  LABEL(100, 80, 0, &Font24_Rot180, "TVOC"),
+  NUMBER(80, 50, 0, &Font20_Rot180, 1, SRC_TVOC, 4, 0, "ppm"),
+  LABEL(50, 30, 0, &Font20_Rot180, "PM2.5"),
+  NUMBER(30, 0, 0, &Font20_Rot180, 1, SRC_PM, 4, 0, ""),
+  {ROWS(0, NO_BAND), 0, 0, &Font16_Rot180, 1, SRC_MODE, 0, 0, "", false}
+};
+static_assert(sizeof(READINGS_ITEMS) / sizeof(READINGS_ITEMS[0]) == FIELD_COUNT, "one item per CanaryFields entry");
+static_assert(rowsMatch(READINGS_ITEMS, FIELD_COUNT, BAND_HEIGHT, 0), "READINGS_ITEMS bands out of order");
+
+// CO2 at twice the size, the other readings without their labels
+static constexpr DisplayItem LARGE_CO2_ITEMS[] = {
+  LABEL(250, 210, 4, &Font24_Rot180, "CO2"),
+  NUMBER(210, 170, 0, &Font20_Rot180, 2, SRC_CO2, 4, 0, ""),
+  LABEL(170, 140, 4, &Font20_Rot180, "ppm"),
+  NUMBER(140, 110, 4, &Font20_Rot180, 1, SRC_TEMPERATURE, 2, 1, "C"),
+  NUMBER(110, 80, 4, &Font20_Rot180, 1, SRC_HUMIDITY, 2, 1, "%"),
+  LABEL(80, 40, 0, &Font20_Rot180, "PM2.5"),
+  NUMBER(40, 0, 0, &Font20_Rot180, 1, SRC_PM, 4, 0, ""),
+  {ROWS(0, NO_BAND), 0, 0, &Font16_Rot180, 1, SRC_MODE, 0, 0, "", false}
+};
+static_assert(sizeof(LARGE_CO2_ITEMS) / sizeof(LARGE_CO2_ITEMS[0]) <= MAX_ITEMS, "too many items");
+static_assert(rowsMatch(LARGE_CO2_ITEMS, sizeof(LARGE_CO2_ITEMS) / sizeof(LARGE_CO2_ITEMS[0]), BAND_HEIGHT, 0),
+              "LARGE_CO2_ITEMS bands out of order");
+
+#undef ROWS
+#define ROWS(y, below) bandRows(y, below, GREETING_HEIGHT)
+
+static constexpr DisplayItem GREETING_ITEMS[] = {
+  {ROWS(140, 120), 0, 4, &Font16_Rot180, 1, SRC_TEXT, 0, 0, " Good Air", false},
+  {ROWS(120, 80), 0, 4, &Font16_Rot180, 1, SRC_TEXT, 0, 0, "  Canary  ", false},
+  {ROWS(80, 60), 0, 4, &Font16_Rot180, 1, SRC_TEXT, 0, 0, "Concept:", false},
+  {ROWS(60, 20), 0, 4, &Font16_Rot180, 1, SRC_TEXT, 0, 0, "Jude Pullen", false},
+  {ROWS(20, 0), 0, 0, &Font16_Rot180, 1, SRC_TEXT, 0, 0, "Code:", false},
+  {ROWS(0, NO_BAND), 0, 0, &Font16_Rot180, 1, SRC_TEXT, 0, 0, "Pete Milne", false}
+};
+static_assert(sizeof(GREETING_ITEMS) / sizeof(GREETING_ITEMS[0]) <= MAX_ITEMS, "too many items");
+static_assert(rowsMatch(GREETING_ITEMS, sizeof(GREETING_ITEMS) / sizeof(GREETING_ITEMS[0]), GREETING_HEIGHT, 0),
+              "GREETING_ITEMS bands out of order");
+
+#undef ROWS
+#undef LABEL
+#undef NUMBER
+
+static const DisplayList READINGS = {READINGS_ITEMS, FIELD_COUNT, BAND_HEIGHT};
+static const DisplayList LARGE_CO2 = {LARGE_CO2_ITEMS, sizeof(LARGE_CO2_ITEMS) / sizeof(LARGE_CO2_ITEMS[0]), BAND_HEIGHT};
+static const DisplayList GREETING = {GREETING_ITEMS, sizeof(GREETING_ITEMS) / sizeof(GREETING_ITEMS[0]), GREETING_HEIGHT};
+
+// Scene hooks: enter draws a scene from scratch when it replaces
+// another one, update redraws what changed while it stays up and clean
+// redraws it with a full refresh when the refresh policy asks. Update
+// and clean are NULL for scenes that never change. restore writes what
+// the scene has on screen back to both RAM planes after a deep sleep
+// that lost them - the framebuffer build restores from the frame.
+const CanaryDisplay::SceneHooks CanaryDisplay::SCENES[SCENE_COUNT] = {
+  {NULL, NULL, NULL, NULL},                                         // SCENE_NONE
+  {&CanaryDisplay::enterLogo, NULL, NULL,
+   &CanaryDisplay::restoreLogo},                                    // SCENE_LOGO
+  {&CanaryDisplay::enterGreeting, NULL, NULL,
+   &CanaryDisplay::restoreGreeting},                                // SCENE_GREETING
+  {&CanaryDisplay::enterReadings, &CanaryDisplay::drawReadings,
+   &CanaryDisplay::cleanReadings, &CanaryDisplay::restoreReadings}, // SCENE_READINGS
+  {&CanaryDisplay::enterTombStone, NULL, NULL,
+   &CanaryDisplay::restoreTombStone}                                // SCENE_TOMBSTONE
+};
+
 void CanaryDisplay::initDisplay(void) {
-  if (_epd.Init() != 0) {
+  _scene = SCENE_NONE;
+  _panel = PANEL_OFF;
+  if (!fullPanel()) {
     return;
   }
   Serial.println("EDP attached");
 
   _epd.ClearFrameMemory(0xFF);   // bit set = white, bit reset = black
   _epd.DisplayFrame();
+  refreshPolicy.noteFull(millis(), false);
+  panelPower.noteActive(millis());
 
   delay(2000);
 
-  _epd.SetFrameMemory_Base(RSLOGO);
-  _epd.DisplayFrame();
+  showScene(SCENE_LOGO);
 }
 
 void CanaryDisplay::showTombStone() {
-  if (_epd.Init() != 0) {
+  if (_state != DISPLAY_IDLE) {
     return;
   }
-
-  delay(2000);
-
-  _epd.SetFrameMemory_Base(TOMBSTONE);
-  _epd.DisplayFrame();
+  memset(&stats, 0, sizeof(stats));
+  showScene(SCENE_TOMBSTONE);
 }
 
+// Start a refresh, or queue one if the panel is still busy.
+// Call pollDisplay() from loop() to finish it.
 void CanaryDisplay::updateDisplay() {
+  if (_state != DISPLAY_IDLE) {
+    _updatePending = true;
+    return;
+  }
+  memset(&stats, 0, sizeof(stats));
   if (_canary->co2 > 9999) {
     _canary->co2 = 0;
   }
-  if (_canary->co2 >= DEAD_CO2) {
-    showTombStone();
-    return;
+  // Waveforms follow the room temperature, from the next LUT load on
+  _epd.SetTemperature((int)_canary->temperature);
+  showScene(_canary->co2 >= DEAD_CO2 ? SCENE_TOMBSTONE : SCENE_READINGS);
+}
+
+// Picks the readings layout, drawn in full by the next updateDisplay()
+void CanaryDisplay::setLayout(DisplayLayouts layout) {
+  if (layout != _layout) {
+    _layout = layout;
+    _shownValid = false;
   }
-  char CO2_string[] = {'0', '0', '0', '0', 'p', 'p', 'm', '\0'};
-  CO2_string[0] = _canary->co2 / 100 / 10 + '0';
-  CO2_string[1] = _canary->co2 / 100 % 10 + '0';
-  CO2_string[2] = _canary->co2 % 100 / 10 + '0';
-  CO2_string[3] = _canary->co2 % 100 % 10 + '0';
+}
 
-  int temp = 0;
-  if (_canary->temperature < 99.9) {
-    temp = (int)(_canary->temperature * 10);
+void CanaryDisplay::showGreeting(void) {
+  if (_state != DISPLAY_IDLE) {
+    return;
   }
-  char TEMP_string[] = {'0', '0', '.', '0', 'C', '\0'};
-  TEMP_string[0] = temp / 10 / 10 + '0';
-  TEMP_string[1] = temp / 10 % 10 + '0';
-  TEMP_string[3] = temp % 10 + '0';
+  memset(&stats, 0, sizeof(stats));
+  showScene(SCENE_GREETING);
+}
 
-  int hum = 0;
-  if (_canary->humidity < 99.9) {
-    hum = (int)(_canary->humidity * 10);
+DisplayScenes CanaryDisplay::currentScene(void) {
+  return _scene;
+}
+
+// Only a change of scene, or new content for the current one, touches
+// the panel - showing the tombstone again costs nothing
+void CanaryDisplay::showScene(DisplayScenes scene) {
+  const SceneHooks& hooks = SCENES[scene];
+  if (scene != _scene) {
+    _scene = hooks.enter && (this->*hooks.enter)() ? scene : SCENE_NONE;
+  } else if (hooks.update) {
+    (this->*hooks.update)();
   }
-  char RH_string[] = {'0', '0', '.', '0', '%', '\0'};
-  RH_string[0] = hum / 10 / 10 + '0';
-  RH_string[1] = hum / 10 % 10 + '0';
-  RH_string[3] = hum % 10 + '0';
+}
 
-  if (_canary->tvoc > 9999) {
-    _canary->tvoc = 0;
+// Puts the panel in full refresh mode, resetting it only if a partial
+// session or a failed init left it in another state
+bool CanaryDisplay::fullPanel(void) {
+  if (_panel != PANEL_FULL) {
+    unsigned long start = micros();
+    bool asleep = _panel == PANEL_SLEEP;
+    if (_epd.Init() != 0) {
+      _panel = PANEL_OFF;
+      return false;
+    }
+    _panel = PANEL_FULL;
+    if (asleep) {
+      // Everything that runs a full refresh rewrites both planes first
+      panelPower.noteWake(micros() - start, false);
+    }
   }
-  char TVOC_string[] = {'0', '0', '0', '0', 'p', 'p', 'm', '\0'};
-  TVOC_string[0] = _canary->tvoc / 100 / 10 + '0';
-  TVOC_string[1] = _canary->tvoc / 100 % 10 + '0';
-  TVOC_string[2] = _canary->tvoc % 100 / 10 + '0';
-  TVOC_string[3] = _canary->tvoc % 100 % 10 + '0';
+  return true;
+}
 
-  if (_canary->pm > 9999) {
-    _canary->pm = 0;
+// Starts a partial refresh session on an initialised panel, or keeps
+// the open one, which lasts until a full refresh or deep sleep. Its
+// reset pulse and LUT load are also all it takes to wake the panel,
+// plus rewriting the screen if the sleep lost the RAM planes.
+bool CanaryDisplay::partialPanel(void) {
+  if (_panel == PANEL_OFF) {
+    return false;
+  }
+  unsigned long start = micros();
+  bool asleep = _panel == PANEL_SLEEP;
+  _epd.BeginPartial();
+  _panel = PANEL_PARTIAL;
+  if (asleep) {
+    bool restore = !panelPower.config.keepRam;
+    if (restore) {
+      restoreScene();
+    }
+    panelPower.noteWake(micros() - start, restore);
   }
-  char PART_string[] = {'0', '0', '0', '0', '\0'};
-  PART_string[0] = _canary->pm / 100 / 10 + '0';
-  PART_string[1] = _canary->pm / 100 % 10 + '0';
-  PART_string[2] = _canary->pm % 100 / 10 + '0';
-  PART_string[3] = _canary->pm % 100 % 10 + '0';
+  return true;
+}
 
-  _paint.SetWidth(120);
-  _paint.SetHeight(40);
-  _paint.SetRotate(ROTATE_180);
+// Rewrites both RAM planes with what is on screen
+void CanaryDisplay::restoreScene(void) {
+#if CANARY_FRAMEBUFFER
+  _epd.SetFrameMemory_Base(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+  stats.bytesSent += 2 * sizeof(frame);
+  stats.windows++;
+  // The 0x26 upload reads the frame in the background, and the caller
+  // is about to draw the new readings into it
+  _epd.WaitTransfer();
+#else
+  const SceneHooks& hooks = SCENES[_scene];
+  if (hooks.restore) {
+    (this->*hooks.restore)();
+  } else {
+    _epd.ClearFrameMemory_Base(0xFF);
+  }
+#endif
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, "CO2", &Font24, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 250, _paint.GetWidth(), _paint.GetHeight());
+void CanaryDisplay::restoreLogo(void) {
+  _epd.SetFrameMemory_Base_PackBits(RSLOGO);
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, CO2_string, &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 230, _paint.GetWidth(), _paint.GetHeight());
+// The greeting is only ever drawn over the logo
+void CanaryDisplay::restoreGreeting(void) {
+  restoreLogo();
+  for (int i = 0; i < GREETING.count; i++) {
+    const DisplayRows& rows = GREETING.items[i].rows;
+    drawItem(GREETING, i);
+    writeStatic(0, rows.y, rows.y0, rows.y1);
+  }
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, "TEMP", &Font24, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 200, _paint.GetWidth(), _paint.GetHeight());
+// Rows outside the layout come back white
+void CanaryDisplay::restoreReadings(void) {
+  const DisplayList& list = _layout == LAYOUT_LARGE_CO2 ? LARGE_CO2 : READINGS;
+  _epd.ClearFrameMemory_Base(0xFF);
+  for (int i = 0; _shownValid && i < list.count; i++) {
+    const DisplayRows& rows = list.items[i].rows;
+    drawItem(list, i);
+    writeStatic(0, rows.y, rows.y0, rows.y1);
+  }
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, TEMP_string, &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 180, _paint.GetWidth(), _paint.GetHeight());
+void CanaryDisplay::restoreTombStone(void) {
+  _epd.SetFrameMemory_Base_PackBits(TOMBSTONE);
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, "RH", &Font24, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 150, _paint.GetWidth(), _paint.GetHeight());
+bool CanaryDisplay::enterLogo(void) {
+  if (!fullPanel()) {
+    return false;
+  }
+  setBase(RSLOGO);
+  _epd.DisplayFrame();
+  refreshPolicy.noteFull(millis(), false);
+  return true;
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, RH_string, &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 130, _paint.GetWidth(), _paint.GetHeight());
+bool CanaryDisplay::enterGreeting(void) {
+  if (!partialPanel()) {
+    return false;
+  }
+  _shownValid = false;
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, "TVOC", &Font24, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 100, _paint.GetWidth(), _paint.GetHeight());
+  bool dirty[MAX_ITEMS];
+  for (int i = 0; i < GREETING.count; i++) {
+    dirty[i] = true;
+  }
+  drawList(GREETING, dirty);
+  flushFrame();
+  startPartial();
+  return true;
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, TVOC_string, &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 80, _paint.GetWidth(), _paint.GetHeight());
+bool CanaryDisplay::enterReadings(void) {
+  if (_panel == PANEL_OFF) {
+    return false;
+  }
+  _shownValid = false;
+  drawReadings();
+  return true;
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, "PM2.5", &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 50, _paint.GetWidth(), _paint.GetHeight());
+// Redraws the readings items whose text changed
+void CanaryDisplay::drawReadings(void) {
+  const DisplayList& list = _layout == LAYOUT_LARGE_CO2 ? LARGE_CO2 : READINGS;
+  bool dirty[MAX_ITEMS];
+  char text[MAX_ITEMS][sizeof(_shown[0])];
+  for (int i = 0; i < list.count; i++) {
+    formatItem(list.items[i], text[i], sizeof(text[i]));
+    dirty[i] = !_shownValid || strcmp(_shown[i], text[i]) != 0;
+    if (dirty[i]) {
+      stats.fieldsDrawn++;
+    }
+  }
+  // A wake that lost the RAM planes redraws them from _shown
+  if (stats.fieldsDrawn == 0 || !partialPanel()) {
+    return; // nothing changed - no upload, no refresh
+  }
+  for (int i = 0; i < list.count; i++) {
+    if (dirty[i]) {
+      strcpy(_shown[i], text[i]);
+    }
+  }
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, PART_string, &Font20, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 30, _paint.GetWidth(), _paint.GetHeight());
+  drawList(list, dirty);
+  _shownValid = true;
 
-  _paint.Clear(UNCOLORED);
+  flushFrame();
+  startPartial();
+}
 
-  if (_canary->demoOn) {
-    _paint.DrawStringAt(0, 0, "Demo Mode", &Font16, COLORED);
-  }
-  else if (_canary->audioOn && _canary->wifiOn) {
-    _paint.DrawStringAt(0, 0, "Wifi Audio", &Font16, COLORED);
+// Redraws the readings into both RAM planes and runs a full refresh to
+// clear the ghosting left by partial updates
+void CanaryDisplay::cleanReadings(void) {
+  if (!_shownValid || !fullPanel()) {
+    return;
   }
-  else if (_canary->wifiOn) {
-    _paint.DrawStringAt(0, 0, "Wifi", &Font16, COLORED);
+  restoreScene();
+  _epd.StartDisplayFrame();
+  refreshPolicy.noteFull(millis(), true);
+  _state = DISPLAY_REFRESHING;
+}
+
+// The tombstone goes up TOMBSTONE_SETTLE_MS later, from pollDisplay()
+bool CanaryDisplay::enterTombStone(void) {
+  if (!fullPanel()) {
+    return false;
   }
-  else if (_canary->audioOn) {
-    _paint.DrawStringAt(0, 0, "Audio", &Font16, COLORED);
+  _settleStart = millis();
+  _state = DISPLAY_SETTLING;
+  return true;
+}
+
+void CanaryDisplay::showTombStoneFrame(void) {
+  setBase(TOMBSTONE);
+  _epd.StartDisplayFrame();
+  refreshPolicy.noteFull(millis(), false);
+  _state = DISPLAY_REFRESHING;
+}
+
+// Starts a partial refresh of what was written and counts it
+void CanaryDisplay::startPartial(void) {
+  _epd.StartDisplayFrame_Partial();
+  refreshPolicy.notePartial(millis(), stats.bytesSent * 8);
+  _state = DISPLAY_REFRESHING;
+}
+
+// Writes a full-screen PackBits flash image to both panel RAM planes
+void CanaryDisplay::setBase(const unsigned char* packed_image) {
+  _epd.SetFrameMemory_Base_PackBits(packed_image);
+#if CANARY_FRAMEBUFFER
+  _epd.WaitTransfer();
+  UnpackBits_P(packed_image, frame, sizeof(frame));
+  _dirtyCount = 0;
+#endif
+  _shownValid = false;
+}
+
+// Draws the dirty items of a list into their bands and sends them
+void CanaryDisplay::drawList(const DisplayList& list, const bool* dirty) {
+#if CANARY_STREAMING && !CANARY_FRAMEBUFFER
+  streamList(list, dirty);
+#else
+  for (int i = 0; i < list.count; i++) {
+    const DisplayRows& rows = list.items[i].rows;
+    if (!dirty[i]) {
+      stats.fieldsSkipped++;
+      stats.bytesSkipped += (rows.y1 - rows.y0 + 1) * (CANARY_FRAMEBUFFER ? EPD_WIDTH : BAND_WIDTH) / 8;
+      continue;
+    }
+    drawItem(list, i);
+    writeBand(0, rows.y, rows.y0, rows.y1);
+    if (list.items[i].isStatic) {
+      _staticPending = true;
+    }
   }
-  else {
-    _paint.DrawStringAt(0, 0, "", &Font16, COLORED);
+#endif
+}
+
+// Writes the static items of the readings layout to both RAM planes,
+// once the refresh that put them on screen is done
+void CanaryDisplay::writeStaticLayer(void) {
+  const DisplayList& list = _layout == LAYOUT_LARGE_CO2 ? LARGE_CO2 : READINGS;
+  _staticPending = false;
+  for (int i = 0; i < list.count; i++) {
+    if (list.items[i].isStatic) {
+      const DisplayRows& rows = list.items[i].rows;
+      drawItem(list, i);
+      writeStatic(0, rows.y, rows.y0, rows.y1);
+    }
   }
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 0, _paint.GetWidth(), _paint.GetHeight());
+}
 
-  _epd.DisplayFrame_Partial();
+// Paints one item into the band buffer. Fixed text comes from the
+// table, everything else from what updateDisplay() last formatted.
+void CanaryDisplay::drawItem(const DisplayList& list, int i) {
+  const DisplayItem& item = list.items[i];
+  nextBand();
+  const char* text = item.source == SRC_TEXT ? item.text : _shown[i];
+  if (list.bandHeight == GREETING_HEIGHT) {
+    _greeting.Clear(UNCOLORED);
+    _greeting.DrawStringAt(item.x, item.textY, text, item.font, COLORED, item.scale);
+  } else {
+    _paint.Clear(UNCOLORED);
+    _paint.DrawStringAt(item.x, item.textY, text, item.font, COLORED, item.scale);
+  }
 }
 
-void CanaryDisplay::showGreeting(void) {
-  _paint.SetWidth(120);
-  _paint.SetHeight(32);
-  _paint.SetRotate(ROTATE_180);
+// Moves the paints to the other band buffer if the panel may still be
+// reading this one. Only one upload runs at a time and the next one
+// waits for it, so the other buffer is free by the time it is sent from.
+void CanaryDisplay::nextBand(void) {
+  if (!_bandSent) {
+    return;
+  }
+  _bandSent = false;
+  _band = (_band + 1) % BAND_BUFFERS;
+  _paint.SetImage(image[_band]);
+  _greeting.SetImage(image[_band]);
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, " Good Air", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 140, _paint.GetWidth(), _paint.GetHeight());
+// Formats an item's text into buf: a number is zero padded to its
+// digits, out of range readings show as zero
+void CanaryDisplay::formatItem(const DisplayItem& item, char* buf, int size) {
+  const char* text = item.text;
+  if (item.source == SRC_MODE) {
+    text = "";
+    if (_canary->demoOn) {
+      text = "Demo Mode";
+    }
+    else if (_canary->audioOn && _canary->wifiOn) {
+      text = "Wifi Audio";
+    }
+    else if (_canary->wifiOn) {
+      text = "Wifi";
+    }
+    else if (_canary->audioOn) {
+      text = "Audio";
+    }
+  }
+  int n = 0;
+  if (item.source != SRC_TEXT && item.source != SRC_MODE) {
+    double value = 0;
+    switch (item.source) {
+      case SRC_CO2: value = _canary->co2; break;
+      case SRC_TEMPERATURE: value = _canary->temperature; break;
+      case SRC_HUMIDITY: value = _canary->humidity; break;
+      case SRC_TVOC: value = _canary->tvoc; break;
+      case SRC_PM: value = _canary->pm; break;
+    }
+    long limit = 1;
+    for (int d = 0; d < item.digits + item.decimals; d++) {
+      limit *= 10;
+    }
+    for (int d = 0; d < item.decimals; d++) {
+      value *= 10;
+    }
+    long scaled = (long)value;
+    if (scaled < 0 || scaled >= limit) {
+      scaled = 0;
+    }
+    int width = item.digits + item.decimals + (item.decimals ? 1 : 0);
+    for (int d = width - 1; d >= 0 && d < size - 1; d--) {
+      if (item.decimals && d == item.digits) {
+        buf[d] = '.';
+        continue;
+      }
+      buf[d] = scaled % 10 + '0';
+      scaled /= 10;
+    }
+    n = width < size - 1 ? width : size - 1;
+  }
+  strncpy(&buf[n], text, size - n - 1);
+  buf[size - 1] = '\0';
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, "  Canary  ", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 120, _paint.GetWidth(), _paint.GetHeight());
+#if CANARY_STREAMING && !CANARY_FRAMEBUFFER
+// Streams the changed part of a list through as few panel windows as
+// the layout allows. Items are walked bottom up, so panel rows ascend.
+// A window runs from a changed item to the last changed item above it
+// with no unowned rows in between; unchanged items inside it are
+// redrawn from their current text. Each band is sent as soon as it is
+// painted, so only the 1KB band buffer is needed.
+void CanaryDisplay::streamList(const DisplayList& list, const bool* dirty) {
+  int stride = BAND_WIDTH / 8;
+  int i = list.count - 1;
+  while (i >= 0) {
+    const DisplayRows& first = list.items[i].rows;
+    if (!dirty[i]) {
+      stats.fieldsSkipped++;
+      stats.bytesSkipped += (first.y1 - first.y0 + 1) * stride;
+      i--;
+      continue;
+    }
+    int last = i;
+    for (int j = i - 1; j >= 0 && list.items[j].rows.y0 == list.items[j + 1].rows.y1 + 1; j--) {
+      if (dirty[j]) {
+        last = j;
+      }
+    }
+    _epd.BeginFrameStream_Partial(0, first.y0, BAND_WIDTH, list.items[last].rows.y1 - first.y0 + 1);
+    for (; i >= last; i--) {
+      const DisplayRows& rows = list.items[i].rows;
+      if (dirty[i] && list.items[i].isStatic) {
+        _staticPending = true;
+      }
+      drawItem(list, i);
+      _epd.SendFrameRows(&image[_band][(rows.y0 - rows.y) * stride], BAND_WIDTH, rows.y1 - rows.y0 + 1);
+      _bandSent = true;
+      stats.bytesSent += (rows.y1 - rows.y0 + 1) * stride;
+    }
+    stats.windows++;
+  }
+}
+#endif
+
+// Sends panel rows y0..y1 of the painted band at (x, y) to the panel,
+// or composes them into the frame when the compositor is enabled.
+// Clipping matches Epd::SetFrameMemory_Partial so both paths give the
+// same image.
+void CanaryDisplay::writeBand(int x, int y, int y0, int y1) {
+  int stride = BAND_WIDTH / 8;
+  if (y1 > EPD_HEIGHT - 1) {
+    y1 = EPD_HEIGHT - 1;
+  }
+  if (y0 < y || y1 < y0) {
+    return;
+  }
+#if CANARY_FRAMEBUFFER
+  int width = BAND_WIDTH;
+  _epd.WaitTransfer();
+  x &= 0xF8;
+  if (x + width > EPD_WIDTH) {
+    width = EPD_WIDTH - x;
+  }
+  for (int j = y0; j <= y1; j++) {
+    memcpy(&frame[j * (EPD_WIDTH / 8) + x / 8], &image[_band][(j - y) * stride], width / 8);
+  }
+  markDirty(y0, y1);
+#else
+  _epd.SetFrameMemory_Partial(&image[_band][(y0 - y) * stride], x, y0, BAND_WIDTH, y1 - y0 + 1);
+  _bandSent = true;
+  stats.bytesSent += (y1 - y0 + 1) * stride;
+  stats.windows++;
+#endif
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, "Concept:", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 80, _paint.GetWidth(), _paint.GetHeight());
+// Writes rows y0..y1 of the band to both panel RAM planes, so the
+// partial waveform sees no change there on later updates
+void CanaryDisplay::writeStatic(int x, int y, int y0, int y1) {
+  int stride = BAND_WIDTH / 8;
+  if (y1 > EPD_HEIGHT - 1) {
+    y1 = EPD_HEIGHT - 1;
+  }
+  if (y0 < y || y1 < y0) {
+    return;
+  }
+#if CANARY_FRAMEBUFFER
+  _epd.WaitTransfer();
+  for (int j = y0; j <= y1; j++) {
+    memcpy(&frame[j * (EPD_WIDTH / 8) + (x & 0xF8) / 8], &image[_band][(j - y) * stride], stride);
+  }
+#endif
+  _epd.SetFrameMemory_Base(&image[_band][(y0 - y) * stride], x, y0, BAND_WIDTH, y1 - y0 + 1);
+  _bandSent = true;
+  stats.bytesSent += 2 * (y1 - y0 + 1) * stride;
+  stats.windows++;
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 4, "Jude Pullen", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 60, _paint.GetWidth(), _paint.GetHeight());
+#if CANARY_FRAMEBUFFER
+// Adds panel rows y0..y1 to the dirty list, merging touching windows
+void CanaryDisplay::markDirty(int y0, int y1) {
+  int i = 0;
+  while (i < _dirtyCount) {
+    if (y0 <= _dirty[i].y1 + 1 && y1 >= _dirty[i].y0 - 1) {
+      y0 = min(y0, _dirty[i].y0);
+      y1 = max(y1, _dirty[i].y1);
+      _dirty[i] = _dirty[--_dirtyCount];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  if (_dirtyCount == MAX_DIRTY) {
+    // Out of slots - fold into the last window
+    _dirtyCount--;
+    y0 = min(y0, _dirty[_dirtyCount].y0);
+    y1 = max(y1, _dirty[_dirtyCount].y1);
+  }
+  _dirty[_dirtyCount].y0 = y0;
+  _dirty[_dirtyCount].y1 = y1;
+  _dirtyCount++;
+}
+#endif
+
+// Uploads the dirty windows of the composed frame - no-op for the banded path
+void CanaryDisplay::flushFrame(void) {
+#if CANARY_FRAMEBUFFER
+  for (int i = 0; i < _dirtyCount; i++) {
+    int rows = _dirty[i].y1 - _dirty[i].y0 + 1;
+    _epd.SetFrameMemory_Partial(&frame[_dirty[i].y0 * (EPD_WIDTH / 8)], 0, _dirty[i].y0, EPD_WIDTH, rows);
+    stats.bytesSent += rows * (EPD_WIDTH / 8);
+    stats.windows++;
+  }
+  _dirtyCount = 0;
+#endif
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, "Code:", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 20, _paint.GetWidth(), _paint.GetHeight());
+bool CanaryDisplay::isBusy(void) {
+  return _state != DISPLAY_IDLE;
+}
 
-  _paint.Clear(UNCOLORED);
-  _paint.DrawStringAt(0, 0, "Pete Milne", &Font16, COLORED);
-  _epd.SetFrameMemory_Partial(_paint.GetImage(), 0, 0, _paint.GetWidth(), _paint.GetHeight());
+// Steps the refresh state machine - never blocks. When idle it also
+// runs the full refresh the refresh policy schedules, and puts the
+// panel into deep sleep once it has been idle long enough.
+void CanaryDisplay::pollDisplay(void) {
+  if (_state == DISPLAY_IDLE) {
+    const SceneHooks& hooks = SCENES[_scene];
+    if (hooks.clean && refreshPolicy.due(millis())) {
+      memset(&stats, 0, sizeof(stats));
+      (this->*hooks.clean)();
+    } else if ((_panel == PANEL_FULL || _panel == PANEL_PARTIAL) && panelPower.due(millis())) {
+      _epd.Sleep(panelPower.config.keepRam);
+      _panel = PANEL_SLEEP;
+      panelPower.noteSleep();
+    }
+    return;
+  }
+  if (_state == DISPLAY_SETTLING) {
+    if (millis() - _settleStart >= TOMBSTONE_SETTLE_MS) {
+      showTombStoneFrame();
+    }
+    return;
+  }
+  if (_epd.IsBusy()) {
+    return;
+  }
+  _state = DISPLAY_IDLE;
+  if (_staticPending && _scene == SCENE_READINGS) {
+    writeStaticLayer();
+  }
+  panelPower.noteActive(millis());
+  if (_refreshDone) {
+    _refreshDone();
+  }
+  if (_updatePending) {
+    _updatePending = false;
+    updateDisplay();
+  }
+}
 
-  _epd.DisplayFrame_Partial();
+void CanaryDisplay::onRefreshDone(void (*callback)(void)) {
+  _refreshDone = callback;
 }
@@ -1,7 +1,10 @@
 #include "DeviceDisplay.h"
 #include "ESDKCanary.h"
 #include "epd2in9_V2.h"
-#include "epdpaint.h"
+#include "basicpaint.h"
+#include "packbits.h"
+#include "refreshpolicy.h"
+#include "panelpower.h"
 #include "tombstone.h"
 #include "rslogo.h"
 
@@ -11,18 +14,163 @@
 #define COLORED     0
 #define UNCOLORED   1
 
+// Full-frame compositor: all bands are drawn into one RAM copy of the
+// screen and uploaded as a single window. It needs 4.7KB of SRAM so
+// AVR builds keep the banded path unless this is set to 1.
+#ifndef CANARY_FRAMEBUFFER
+#if defined(__AVR__)
+#define CANARY_FRAMEBUFFER 0
+#else
+#define CANARY_FRAMEBUFFER 1
+#endif
+#endif
+
+// Streaming renderer for builds without the compositor: each run of
+// changed rows goes out as one panel window, band by band, straight
+// from the 1KB band buffer instead of one window per field. Only used
+// when CANARY_FRAMEBUFFER is 0, the AVR default - see README.md.
+#ifndef CANARY_STREAMING
+#define CANARY_STREAMING 0
+#endif
+
+// Readings band size
+#define BAND_WIDTH  120
+#define BAND_HEIGHT 40
+#define GREETING_HEIGHT 32
+#define MAX_DIRTY   4
+#define MAX_ITEMS   12
+
+// With background uploads one band buffer is painted while the panel
+// is still reading the other
+#define BAND_BUFFERS (EPD_ASYNC ? 2 : 1)
+
+// Readings fields in draw order, see READINGS_ITEMS in CanaryDisplay.cpp
+enum CanaryFields {
+  CO2_LABEL, CO2_VALUE,
+  TEMP_LABEL, TEMP_VALUE,
+  RH_LABEL, RH_VALUE,
+  TVOC_LABEL, TVOC_VALUE,
+  PM_LABEL, PM_VALUE,
+  MODE_LINE,
+  FIELD_COUNT
+};
+
+// Per-update counters, reset by each updateDisplay()
+struct DisplayStats {
+  unsigned int fieldsDrawn;
+  unsigned int fieldsSkipped;
+  unsigned int windows;
+  unsigned long bytesSent;
+  unsigned long bytesSkipped;
+};
+
+struct DirtyRows {
+  int y0;
+  int y1;
+};
+
+// Painters for the shared band buffer - the panel is always drawn upside down
+typedef BasicPaint<ROTATE_180, BAND_WIDTH, BAND_HEIGHT> BandPaint;
+typedef BasicPaint<ROTATE_180, BAND_WIDTH, GREETING_HEIGHT> GreetingPaint;
+
+struct DisplayItem;
+struct DisplayList;
+
+// Readings screen layouts, see setLayout()
+enum DisplayLayouts {LAYOUT_READINGS, LAYOUT_LARGE_CO2};
+
+// Screens the display can show, see CanaryDisplay::SCENES
+enum DisplayScenes {SCENE_NONE, SCENE_LOGO, SCENE_GREETING, SCENE_READINGS, SCENE_TOMBSTONE, SCENE_COUNT};
+
+// What the panel was last set up for
+enum PanelModes {PANEL_OFF, PANEL_FULL, PANEL_PARTIAL, PANEL_SLEEP};
+
+// Refresh progress - the panel is only touched while IDLE. SETTLING
+// waits out TOMBSTONE_SETTLE_MS before the tombstone refresh starts.
+enum DisplayStates {DISPLAY_IDLE, DISPLAY_SETTLING, DISPLAY_REFRESHING};
+
+// Pause before the tombstone replaces the last screen, ms
+#define TOMBSTONE_SETTLE_MS 2000
+
 class CanaryDisplay : public DeviceDisplay {
   public:
-  unsigned char image[1024];
+  unsigned char image[BAND_BUFFERS][1024];
+#if CANARY_FRAMEBUFFER
+  unsigned char frame[EPD_WIDTH / 8 * EPD_HEIGHT];
+#endif
   Epd _epd; // default reset: 8, dc: 9, cs: 10, busy: 7
-  Paint _paint = Paint(image, 0, 0);
+  int _band = 0;  // buffer the paints draw into
+  bool _bandSent = false;
+  BandPaint _paint = BandPaint(image[0]);
+  GreetingPaint _greeting = GreetingPaint(image[0]);
   ESDKCanary* _canary;
+  DisplayStates _state = DISPLAY_IDLE;
+  unsigned long _settleStart = 0;
+  DisplayScenes _scene = SCENE_NONE;
+  PanelModes _panel = PANEL_OFF;
+  bool _updatePending = false;
+  void (*_refreshDone)(void) = NULL;
+  DisplayLayouts _layout = LAYOUT_READINGS;
+  char _shown[MAX_ITEMS][12];  // text currently on the panel per item
+  bool _shownValid = false;
+  bool _staticPending = false;  // labels on screen but only in 0x24
+#if CANARY_FRAMEBUFFER
+  DirtyRows _dirty[MAX_DIRTY];
+  int _dirtyCount = 0;
+#endif
+  DisplayStats stats;
+  RefreshPolicy refreshPolicy;
+  PanelPower panelPower;
 
   CanaryDisplay(ESDKCanary* canary) : _canary(canary) {};
   void initDisplay(void);
   void updateDisplay(void);
   void showGreeting(void);
   void showTombStone(void);
+  void setLayout(DisplayLayouts layout);
+  DisplayScenes currentScene(void);
+  bool isBusy(void);
+  void pollDisplay(void);
+  void onRefreshDone(void (*callback)(void));
+  private:
+  struct SceneHooks {
+    bool (CanaryDisplay::*enter)(void);
+    void (CanaryDisplay::*update)(void);
+    void (CanaryDisplay::*clean)(void);
+    void (CanaryDisplay::*restore)(void);
+  };
+  static const SceneHooks SCENES[SCENE_COUNT];
+  void showScene(DisplayScenes scene);
+  bool fullPanel(void);
+  bool partialPanel(void);
+  void restoreScene(void);
+  void restoreLogo(void);
+  void restoreGreeting(void);
+  void restoreReadings(void);
+  void restoreTombStone(void);
+  bool enterLogo(void);
+  bool enterGreeting(void);
+  bool enterReadings(void);
+  void drawReadings(void);
+  void cleanReadings(void);
+  bool enterTombStone(void);
+  void showTombStoneFrame(void);
+  void startPartial(void);
+  void setBase(const unsigned char* packed_image);
+  void drawList(const DisplayList& list, const bool* dirty);
+  void writeStaticLayer(void);
+  void drawItem(const DisplayList& list, int i);
+  void nextBand(void);
+  void formatItem(const DisplayItem& item, char* buf, int size);
+#if CANARY_STREAMING && !CANARY_FRAMEBUFFER
+  void streamList(const DisplayList& list, const bool* dirty);
+#endif
+  void writeBand(int x, int y, int y0, int y1);
+  void writeStatic(int x, int y, int y0, int y1);
+#if CANARY_FRAMEBUFFER
+  void markDirty(int y0, int y1);
+#endif
+  void flushFrame(void);
 };
 
 #endif
@@ -6,6 +6,8 @@ public:
   virtual void initDisplay(void) = 0;
   virtual void updateDisplay(void) = 0;
   virtual void showGreeting(void) = 0;
+  virtual bool isBusy(void) = 0;
+  virtual void pollDisplay(void) = 0;
 };
 
 #endif
@@ -12,6 +12,8 @@ ESDKCanary::ESDKCanary(Adafruit_PWMServoDriver *pwm, int servo) {
 }
 
 void ESDKCanary::updateCanary() {
+  // A new state replaces whatever gesture is still running
+  clearMotions();
   switch (state) {
     case THATS_BETTER:
       Tweet(THATS_BETTER_TRACK, audioOn);
@@ -33,11 +35,12 @@ void ESDKCanary::updateCanary() {
       if (!demoOn) {
         Tweet(DEAD_TRACK, audioOn);
         Dead(DEAD_POS, VFAST);
-        while (1);// Program ends!! Reboot
+        // Terminal - nothing moves the canary again until a reset
+        _latched = true;
       } else {
         StartPos(WINGS_DOWN);
-        delay(2000);
-        Tweet(DEAD_TRACK, audioOn);
+        Pause(2000);
+        queueTweet(DEAD_TRACK);
         PassOut(PASS_OUT_POS, FAST);
         StartPos(WINGS_DOWN);
       }
@@ -48,6 +51,10 @@ void ESDKCanary::updateCanary() {
 States ESDKCanary::updateState() {
   static States previousState = NORMAL;
 
+  if (_latched) {
+    return state;
+  }
+
   if ((previousState == PASS_OUT) && (co2 < PASS_OUT_CO2)) {
     state = THATS_BETTER;
   }
@@ -76,54 +83,131 @@ States ESDKCanary::updateState() {
   return state;
 }
 
-void ESDKCanary::StartPos(uint16_t start_pos) {
-  // Move wings to start position
-  for (; _pulselen < start_pos; _pulselen++) {
-    _pwm->setPWM(_servo, 0, _pulselen);
-    delay(VSLOW);
+// Advances the queued motion to where it should be by now - never
+// blocks. Call it from loop() as often as possible; a late call
+// catches up, sending the steps it missed as one pulse, and the
+// schedule keeps its own time rather than the time of the call
+void ESDKCanary::tick(unsigned long now) {
+  if (_restart) {
+    // First motion since the queue was empty starts now
+    _restart = false;
+    _since = now;
+    _wait = 0;
   }
-}
+  while (_queued > 0 && now - _since >= _wait) {
+    _since += _wait;
+    _wait = 0;
+    const Motion& motion = _motions[_head];
+    if (!_started) {
+      _started = true;
+      _target = 0;
+      _pass = 0;
+      _holding = false;
+      if (motion.track != NO_TRACK) {
+        Tweet(motion.track, audioOn);
+      }
+    }
 
-void ESDKCanary::Flap(uint16_t down_pos, uint16_t up_pos, int speed_idx, int flaps) {
-  // Move wings back and fourth
-  // Note that the value of pulselen is inverted!
-  // speed_idx  0 is fastest
-
-  for (int i = 0; i < flaps; i++) {
-    // Up
-    for (; _pulselen > up_pos; _pulselen--) {
-      _pwm->setPWM(_servo, 0, _pulselen);
-      delay(speed_idx);
+    if (!_holding) {
+      if (_target < motion.count && _pulselen != motion.targets[_target]) {
+        uint16_t target = motion.targets[_target];
+        unsigned long distance = _pulselen < target ? target - _pulselen : _pulselen - target;
+        unsigned long steps = motion.speed ? 1 + (now - _since) / motion.speed : distance;
+        if (steps > distance) {
+          steps = distance;
+        }
+        int dir = _pulselen < target ? 1 : -1;
+        long delta = (long)steps * dir;
+        // Note that the value of pulselen is inverted!
+        _pwm->setPWM(_servo, 0, _pulselen + delta - dir);
+        _pulselen += delta;
+        _since += (steps - 1) * motion.speed;
+        _wait = motion.speed;
+        continue;
+      }
+      _holding = true;
+      _wait = motion.hold;
+      continue;
+    }
+    _holding = false;
+    if (++_target < motion.count) {
+      continue;
     }
-    delay(100);
-    // Down
-    for (; _pulselen < down_pos; _pulselen++) {
-      _pwm->setPWM(_servo, 0, _pulselen);
-      delay(speed_idx);
+    if (++_pass < motion.repeats) {
+      _target = 0;
+      continue;
     }
-    delay(100);
+
+    // Motion done, the next one carries on from its end time
+    _head = (_head + 1) % MOTION_QUEUE;
+    _queued--;
+    _started = false;
   }
 }
 
-void ESDKCanary::PassOut(uint16_t end_pos, int speed_idx) {
-  // Move wings to pass out position and hold it
-  // Note that the value of pulselen is inverted!
+bool ESDKCanary::isMoving() {
+  return _queued > 0;
+}
 
-  for (; _pulselen > end_pos; _pulselen--) {
-    _pwm->setPWM(_servo, 0, _pulselen);
-    delay(speed_idx);
+// Drops the running and pending motions, the wings stay where they are
+void ESDKCanary::clearMotions() {
+  if (_latched) {
+    return;
   }
+  _queued = 0;
+  _started = false;
 }
 
+uint16_t ESDKCanary::getPulselen() {
+  return _pulselen;
+}
+
+bool ESDKCanary::queueMotion(const Motion& motion) {
+  if (_latched || _queued == MOTION_QUEUE || motion.repeats == 0) {
+    return false;
+  }
+  _motions[(_head + _queued) % MOTION_QUEUE] = motion;
+  if (_queued++ == 0) {
+    _restart = true;
+  }
+  return true;
+}
+
+void ESDKCanary::queueTweet(uint8_t track) {
+  Motion tweet = {{0, 0}, 0, 0, 0, 1, track};
+  queueMotion(tweet);
+}
+
+void ESDKCanary::StartPos(uint16_t start_pos) {
+  // Move wings to start position
+  Motion start = {{start_pos, start_pos}, 1, VSLOW, 0, 1, NO_TRACK};
+  queueMotion(start);
+}
+
+void ESDKCanary::Flap(uint16_t down_pos, uint16_t up_pos, int speed_idx, int flaps) {
+  // Move wings back and fourth
+  // speed_idx is ms per step, VFAST is fastest
+  Motion flap = {{up_pos, down_pos}, 2, (uint8_t)speed_idx, FLAP_HOLD, (uint8_t)flaps, NO_TRACK};
+  queueMotion(flap);
+}
+
+void ESDKCanary::PassOut(uint16_t end_pos, int speed_idx) {
+  // Move wings to pass out position and hold it
+  Motion passOut = {{end_pos, end_pos}, 1, (uint8_t)speed_idx, 0, 1, NO_TRACK};
+  queueMotion(passOut);
+}
 
 void ESDKCanary::Dead(uint16_t end_pos, int speed_idx) {
   // Move servo past tipping point then retract wings.
   // This position should only be recovered by resetting the system
+  Motion dead = {{end_pos, end_pos}, 1, (uint8_t)speed_idx, 0, 1, NO_TRACK};
+  queueMotion(dead);
+}
 
-  for (; _pulselen > end_pos; _pulselen--) {
-    _pwm->setPWM(_servo, 0, _pulselen);
-    delay(speed_idx);
-  }
+// Holds the wings still for ms before the next motion
+void ESDKCanary::Pause(unsigned int ms) {
+  Motion pause = {{0, 0}, 0, 0, (uint16_t)ms, 1, NO_TRACK};
+  queueMotion(pause);
 }
 
 void ESDKCanary::Tweet(uint8_t track, boolean audio = true) {
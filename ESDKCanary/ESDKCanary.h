@@ -33,6 +33,22 @@ enum flap_speeds {VFAST = 1, FAST, SLOW, VSLOW};
 
 enum States {NORMAL, STUFFY, OPEN_WINDOW, PASS_OUT, DEAD, THATS_BETTER};
 
+// Pending servo moves, see tick()
+#define MOTION_QUEUE 8
+#define FLAP_HOLD 100  // pause at each end of a flap, ms
+#define NO_TRACK 0xFF
+
+// A gesture: step towards each target in turn, one pulse per speed ms,
+// holding hold ms at each, and run the targets repeats times
+struct Motion {
+  uint16_t targets[2];
+  uint8_t count;   // targets in use
+  uint8_t speed;
+  uint16_t hold;
+  uint8_t repeats;
+  uint8_t track;   // played as the motion starts, NO_TRACK for none
+};
+
 class ESDKCanary {
   public:
     int co2 = 400;
@@ -51,13 +67,31 @@ class ESDKCanary {
     Adafruit_Soundboard *_sfx;
     int _servo;
     uint16_t _pulselen;
+    Motion _motions[MOTION_QUEUE];
+    uint8_t _head = 0;
+    uint8_t _queued = 0;
+    uint8_t _target = 0;  // index into the current motion's targets
+    uint8_t _pass = 0;
+    bool _holding = false;
+    bool _started = false;
+    bool _latched = false;  // terminal motion queued, see DEAD
+    unsigned long _since = 0;
+    unsigned long _wait = 0;
+    bool _restart = false;  // next tick starts the schedule at its now
+    bool queueMotion(const Motion& motion);
+    void queueTweet(uint8_t track);
  public:
     void updateCanary();
     States updateState();
+    void tick(unsigned long now);
+    bool isMoving(void);
+    void clearMotions(void);
+    uint16_t getPulselen(void);
     void StartPos(uint16_t start_pos);
     void Flap(uint16_t down_pos, uint16_t up_pos, int speed_idx, int flaps);
     void PassOut(uint16_t end_pos, int speed_idx);
     void Dead(uint16_t end_pos, int speed_idx);
+    void Pause(unsigned int ms);
     void Tweet(uint8_t track, boolean audio);
 };
 
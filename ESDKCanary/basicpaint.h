@@ -0,0 +1,408 @@
+/**
+ *  @filename   :   basicpaint.h
+ *  @brief      :   Paint tools with the rotation and size fixed at
+ *                  compile time. Paint in epdpaint.h dispatches to the
+ *                  same kernels at run time.
+ */
+
+#ifndef BASICPAINT_H
+#define BASICPAINT_H
+
+#include <avr/pgmspace.h>
+#include "epdpaint.h"
+
+/**
+ *  @brief: where the rows of one glyph are stored. rows top..bottom of
+ *          the glyph cell are data_bytes each, bit 7 at column left.
+ */
+struct PaintGlyph {
+    const unsigned char* data;
+    int left;
+    int top;
+    int bottom;
+    int data_bytes;
+};
+
+/**
+ *  @brief: drawing that does not depend on the rotation. the image is
+ *          width x height pixels, 1 bit per pixel, width a multiple of 8.
+ */
+struct PaintSpans {
+    static void Clear(unsigned char* image, int width, int height, int colored);
+    static void FillAbsoluteRect(unsigned char* image, int width, int height,
+                                 int x0, int y0, int x1, int y1, int colored);
+    static bool FindGlyph(sFONT* font, char ascii_char, PaintGlyph* glyph);
+
+    static inline void DrawAbsolutePixel(unsigned char* image, int width, int height,
+                                         int x, int y, int colored) {
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return;
+        }
+        bool set = IF_INVERT_COLOR ? colored : !colored;
+        if (set) {
+            image[y * (width / 8) + x / 8] |= 0x80 >> (x % 8);
+        } else {
+            image[y * (width / 8) + x / 8] &= ~(0x80 >> (x % 8));
+        }
+    }
+
+    /* reverse the bit order of a 32 bit word */
+    static inline uint32_t ReverseBits(uint32_t v) {
+        v = ((v >> 1) & 0x55555555UL) | ((v & 0x55555555UL) << 1);
+        v = ((v >> 2) & 0x33333333UL) | ((v & 0x33333333UL) << 2);
+        v = ((v >> 4) & 0x0F0F0F0FUL) | ((v & 0x0F0F0F0FUL) << 4);
+        v = ((v >> 8) & 0x00FF00FFUL) | ((v & 0x00FF00FFUL) << 8);
+        return (v >> 16) | (v << 16);
+    }
+};
+
+/**
+ *  @brief: drawing in logical coordinates for one rotation. every
+ *          rotation test is on the template argument, so it folds away.
+ */
+template <int Rotation>
+struct PaintKernel : PaintSpans {
+    /* logical width and height of the image */
+    static inline int LogicalWidth(int width, int height) {
+        return Rotation == ROTATE_0 || Rotation == ROTATE_180 ? width : height;
+    }
+    static inline int LogicalHeight(int width, int height) {
+        return Rotation == ROTATE_0 || Rotation == ROTATE_180 ? height : width;
+    }
+    /* rotated coordinates of 0 map just outside the image */
+    static inline int FirstX(void) {
+        return Rotation == ROTATE_180 || Rotation == ROTATE_270 ? 1 : 0;
+    }
+    static inline int FirstY(void) {
+        return Rotation == ROTATE_90 || Rotation == ROTATE_180 ? 1 : 0;
+    }
+
+    static inline void DrawPixel(unsigned char* image, int width, int height,
+                                 int x, int y, int colored) {
+        if (x < 0 || x >= LogicalWidth(width, height) || y < 0 || y >= LogicalHeight(width, height)) {
+            return;
+        }
+        if (Rotation == ROTATE_0) {
+            DrawAbsolutePixel(image, width, height, x, y, colored);
+        } else if (Rotation == ROTATE_90) {
+            DrawAbsolutePixel(image, width, height, width - y, x, colored);
+        } else if (Rotation == ROTATE_180) {
+            DrawAbsolutePixel(image, width, height, width - x, height - y, colored);
+        } else if (Rotation == ROTATE_270) {
+            DrawAbsolutePixel(image, width, height, y, height - x, colored);
+        }
+    }
+
+    /**
+     *  @brief: fills a rectangle by the coordinates (inclusive). it is
+     *          clipped the same way DrawPixel clips.
+     */
+    static void FillRect(unsigned char* image, int width, int height,
+                         int x0, int y0, int x1, int y1, int colored) {
+        int x_max = LogicalWidth(width, height) - 1;
+        int y_max = LogicalHeight(width, height) - 1;
+        if (x0 < FirstX()) x0 = FirstX();
+        if (y0 < FirstY()) y0 = FirstY();
+        if (x1 > x_max) x1 = x_max;
+        if (y1 > y_max) y1 = y_max;
+        if (x0 > x1 || y0 > y1) {
+            return;
+        }
+        if (Rotation == ROTATE_0) {
+            FillAbsoluteRect(image, width, height, x0, y0, x1, y1, colored);
+        } else if (Rotation == ROTATE_90) {
+            FillAbsoluteRect(image, width, height, width - y1, x0, width - y0, x1, colored);
+        } else if (Rotation == ROTATE_180) {
+            FillAbsoluteRect(image, width, height, width - x1, height - y1,
+                             width - x0, height - y0, colored);
+        } else if (Rotation == ROTATE_270) {
+            FillAbsoluteRect(image, width, height, y0, height - x1, y1, height - x0, colored);
+        }
+    }
+
+    /**
+     *  @brief: draws a charactor. each glyph row is read from flash once.
+     *          for ROTATE_0 and ROTATE_180 the row is shifted straight
+     *          into the image bytes, with anything outside the image
+     *          masked off, instead of being drawn pixel by pixel. a font
+     *          stored in the painter's rotation (see tools/fontgen.py)
+     *          needs no bit reversal at all. trimmed fonts only store the
+     *          glyph's bounding box, which is decoded in the same pass.
+     */
+    static void DrawCharAt(unsigned char* image, int width, int height,
+                           int x, int y, char ascii_char, sFONT* font, int colored) {
+        int i, k, s;
+        int row_bytes = font->Width / 8 + (font->Width % 8 ? 1 : 0);
+        PaintGlyph glyph;
+        if (!FindGlyph(font, ascii_char, &glyph)) {
+            return;
+        }
+        const unsigned char* ptr = glyph.data;
+        int left = glyph.left, top = glyph.top, bottom = glyph.bottom;
+        int data_bytes = glyph.data_bytes;
+        /* glyphs stored upside down */
+        bool flipped = font->Rotate == ROTATE_180;
+
+        if (row_bytes > 3 || (Rotation != ROTATE_0 && Rotation != ROTATE_180)) {
+            for (s = top; s <= bottom; s++) {
+                for (k = 0; k < data_bytes; k++) {
+                    unsigned char bits = pgm_read_byte(ptr++);
+                    for (i = left + k * 8; bits; i++, bits <<= 1) {
+                        if (!(bits & 0x80)) {
+                            continue;
+                        }
+                        if (flipped) {
+                            DrawPixel(image, width, height, x + font->Width - 1 - i,
+                                      y + font->Height - 1 - s, colored);
+                        } else {
+                            DrawPixel(image, width, height, x + i, y + s, colored);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+
+        /* bit 0 of an output row lands on image column col */
+        bool reverse = flipped != (Rotation == ROTATE_180);
+        int col = Rotation == ROTATE_180 ? width - x - (font->Width - 1) : x;
+        int b0 = FirstX() - col > 0 ? FirstX() - col : 0;
+        int b1 = width - 1 - col < font->Width - 1 ? width - 1 - col : font->Width - 1;
+        if (b0 > b1) {
+            return;
+        }
+        uint32_t mask = (0xFFFFFFFFUL >> b0) & ~(0xFFFFFFFFUL >> (b1 + 1));
+        bool set = IF_INVERT_COLOR ? colored : !colored;
+
+        for (s = top; s <= bottom; s++, ptr += data_bytes) {
+            /* glyph row j is at logical y + j */
+            int j = flipped ? font->Height - 1 - s : s;
+            int line = Rotation == ROTATE_180 ? height - y - j : y + j;
+            if (line < FirstY() || line >= height) {
+                continue;
+            }
+            uint32_t row = 0;
+            for (k = 0; k < data_bytes; k++) {
+                row |= (uint32_t)pgm_read_byte(ptr + k) << (24 - 8 * k);
+            }
+            row >>= left;
+            if (reverse) {
+                row = ReverseBits(row) << (32 - font->Width);
+            }
+            row &= mask;
+            if (row == 0) {
+                continue;
+            }
+            int c = col;
+            if (c < 0) {
+                row <<= -c;
+                c = 0;
+            }
+            row >>= c % 8;
+            unsigned char* dst = &image[line * (width / 8) + c / 8];
+            for (k = 0; row; k++, row <<= 8) {
+                unsigned char bits = row >> 24;
+                if (set) {
+                    dst[k] |= bits;
+                } else {
+                    dst[k] &= ~bits;
+                }
+            }
+        }
+    }
+
+    static void DrawStringAt(unsigned char* image, int width, int height,
+                             int x, int y, const char* text, sFONT* font, int colored) {
+        /* Send the string character by character on EPD */
+        for (const char* p_text = text; *p_text != 0; p_text++, x += font->Width) {
+            DrawCharAt(image, width, height, x, y, *p_text, font, colored);
+        }
+    }
+
+    /**
+     *  @brief: draws a charactor scale times its size. each run of set
+     *          bits in a glyph row becomes one scale-high span fill, so
+     *          nothing is drawn pixel by pixel.
+     */
+    static void DrawCharScaled(unsigned char* image, int width, int height,
+                               int x, int y, char ascii_char, sFONT* font, int colored, int scale) {
+        PaintGlyph glyph;
+        if (!FindGlyph(font, ascii_char, &glyph)) {
+            return;
+        }
+        bool flipped = font->Rotate == ROTATE_180;
+        const unsigned char* ptr = glyph.data;
+        for (int s = glyph.top; s <= glyph.bottom; s++) {
+            int j = flipped ? font->Height - 1 - s : s;
+            int y0 = y + j * scale;
+            int run = -1;
+            int end = glyph.left + glyph.data_bytes * 8;
+            unsigned char bits = 0;
+            for (int i = glyph.left; i <= end; i++) {
+                if ((i - glyph.left) % 8 == 0 && i < end) {
+                    bits = pgm_read_byte(ptr++);
+                }
+                bool on = i < end && (bits & 0x80);
+                bits <<= 1;
+                if (on && run < 0) {
+                    run = i;
+                } else if (!on && run >= 0) {
+                    /* glyph columns run..i-1 */
+                    int c0 = flipped ? font->Width - i : run;
+                    int c1 = flipped ? font->Width - 1 - run : i - 1;
+                    FillRect(image, width, height, x + c0 * scale, y0,
+                             x + c1 * scale + scale - 1, y0 + scale - 1, colored);
+                    run = -1;
+                }
+            }
+        }
+    }
+
+    static void DrawStringScaled(unsigned char* image, int width, int height,
+                                 int x, int y, const char* text, sFONT* font, int colored, int scale) {
+        if (scale <= 1) {
+            DrawStringAt(image, width, height, x, y, text, font, colored);
+            return;
+        }
+        for (const char* p_text = text; *p_text != 0; p_text++, x += font->Width * scale) {
+            DrawCharScaled(image, width, height, x, y, *p_text, font, colored, scale);
+        }
+    }
+
+    static void DrawLine(unsigned char* image, int width, int height,
+                         int x0, int y0, int x1, int y1, int colored) {
+        /* Bresenham algorithm */
+        int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
+        int sx = x0 < x1 ? 1 : -1;
+        int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
+        int sy = y0 < y1 ? 1 : -1;
+        int err = dx + dy;
+
+        while((x0 != x1) && (y0 != y1)) {
+            DrawPixel(image, width, height, x0, y0 , colored);
+            if (2 * err >= dy) {
+                err += dy;
+                x0 += sx;
+            }
+            if (2 * err <= dx) {
+                err += dx;
+                y0 += sy;
+            }
+        }
+    }
+
+    static void DrawRectangle(unsigned char* image, int width, int height,
+                              int x0, int y0, int x1, int y1, int colored) {
+        int min_x = x1 > x0 ? x0 : x1;
+        int max_x = x1 > x0 ? x1 : x0;
+        int min_y = y1 > y0 ? y0 : y1;
+        int max_y = y1 > y0 ? y1 : y0;
+
+        FillRect(image, width, height, min_x, min_y, max_x, min_y, colored);
+        FillRect(image, width, height, min_x, max_y, max_x, max_y, colored);
+        FillRect(image, width, height, min_x, min_y, min_x, max_y, colored);
+        FillRect(image, width, height, max_x, min_y, max_x, max_y, colored);
+    }
+
+    static void DrawCircle(unsigned char* image, int width, int height,
+                           int x, int y, int radius, int colored, bool filled) {
+        /* Bresenham algorithm */
+        int x_pos = -radius;
+        int y_pos = 0;
+        int err = 2 - 2 * radius;
+        int e2;
+
+        do {
+            DrawPixel(image, width, height, x - x_pos, y + y_pos, colored);
+            DrawPixel(image, width, height, x + x_pos, y + y_pos, colored);
+            DrawPixel(image, width, height, x + x_pos, y - y_pos, colored);
+            DrawPixel(image, width, height, x - x_pos, y - y_pos, colored);
+            if (filled) {
+                FillRect(image, width, height, x + x_pos, y + y_pos, x - x_pos, y + y_pos, colored);
+                FillRect(image, width, height, x + x_pos, y - y_pos, x - x_pos, y - y_pos, colored);
+            }
+            e2 = err;
+            if (e2 <= y_pos) {
+                err += ++y_pos * 2 + 1;
+                if(-x_pos == y_pos && e2 <= x_pos) {
+                    e2 = 0;
+                }
+            }
+            if (e2 > x_pos) {
+                err += ++x_pos * 2 + 1;
+            }
+        } while (x_pos <= 0);
+    }
+};
+
+/**
+ *  @brief: a painter whose rotation and size are template arguments.
+ *          Width must be a multiple of 8 - the image is Width / 8 * Height
+ *          bytes.
+ */
+template <int Rotation, int Width, int Height>
+class BasicPaint {
+public:
+    static_assert(Width % 8 == 0, "BasicPaint width must be a multiple of 8");
+    typedef PaintKernel<Rotation> Kernel;
+
+    BasicPaint(unsigned char* image) : image(image) {}
+
+    unsigned char* GetImage(void) { return this->image; }
+    void SetImage(unsigned char* image) { this->image = image; }
+    int  GetWidth(void) { return Width; }
+    int  GetHeight(void) { return Height; }
+    int  GetRotate(void) { return Rotation; }
+
+    void Clear(int colored) {
+        Kernel::Clear(image, Width, Height, colored);
+    }
+    void DrawAbsolutePixel(int x, int y, int colored) {
+        Kernel::DrawAbsolutePixel(image, Width, Height, x, y, colored);
+    }
+    void DrawPixel(int x, int y, int colored) {
+        Kernel::DrawPixel(image, Width, Height, x, y, colored);
+    }
+    void DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored) {
+        Kernel::DrawCharAt(image, Width, Height, x, y, ascii_char, font, colored);
+    }
+    void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored) {
+        Kernel::DrawStringAt(image, Width, Height, x, y, text, font, colored);
+    }
+    void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored, int scale) {
+        Kernel::DrawStringScaled(image, Width, Height, x, y, text, font, colored, scale);
+    }
+    void DrawLine(int x0, int y0, int x1, int y1, int colored) {
+        Kernel::DrawLine(image, Width, Height, x0, y0, x1, y1, colored);
+    }
+    void DrawHorizontalLine(int x, int y, int line_width, int colored) {
+        if (line_width > 0) {
+            Kernel::FillRect(image, Width, Height, x, y, x + line_width - 1, y, colored);
+        }
+    }
+    void DrawVerticalLine(int x, int y, int line_height, int colored) {
+        if (line_height > 0) {
+            Kernel::FillRect(image, Width, Height, x, y, x, y + line_height - 1, colored);
+        }
+    }
+    void DrawRectangle(int x0, int y0, int x1, int y1, int colored) {
+        Kernel::DrawRectangle(image, Width, Height, x0, y0, x1, y1, colored);
+    }
+    void DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored) {
+        Kernel::FillRect(image, Width, Height, x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                         x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, colored);
+    }
+    void DrawCircle(int x, int y, int radius, int colored) {
+        Kernel::DrawCircle(image, Width, Height, x, y, radius, colored, false);
+    }
+    void DrawFilledCircle(int x, int y, int radius, int colored) {
+        Kernel::DrawCircle(image, Width, Height, x, y, radius, colored, true);
+    }
+
+private:
+    unsigned char* image;
+};
+
+#endif
+
+/* END OF FILE */
@@ -27,7 +27,7 @@
 #include <stdlib.h>
 #include "epd2in9_V2.h"
 
-unsigned char _WF_PARTIAL_2IN9[159] =
+const unsigned char _WF_PARTIAL_2IN9[159] PROGMEM =
 {
 0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
 0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
@@ -50,7 +50,7 @@ unsigned char _WF_PARTIAL_2IN9[159] =
 0x22,0x17,0x41,0xB0,0x32,0x36,
 };
 
-unsigned char WS_20_30[159] =
+const unsigned char WS_20_30[159] PROGMEM =
 {											
 0x80,	0x66,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x40,	0x0,	0x0,	0x0,
 0x10,	0x66,	0x0,	0x0,	0x0,	0x0,	0x0,	0x0,	0x20,	0x0,	0x0,	0x0,
@@ -73,16 +73,181 @@ unsigned char WS_20_30[159] =
 0x22,	0x17,	0x41,	0x0,	0x32,	0x36
 };	
 
+#if EPD_TEMPERATURE_BANDS
+/* the 20-30 C waveforms above with every phase stretched or cut short,
+   for the other temperature bands. starting points, tune them on the panel */
+const unsigned char WS_COLD[159] PROGMEM =
+{
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x28,0x10,0x0,0x0,0x0,0x0,0x1,
+0x14,0x14,0x0,0x14,0x14,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x28,0x10,0x0,0x2,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x44,0x44,0x44,0x44,0x44,0x44,0x0,0x0,0x0,
+0x22,0x17,0x41,0x0,0x32,0x36,
+};
+
+const unsigned char WS_COOL[159] PROGMEM =
+{
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1E,0xC,0x0,0x0,0x0,0x0,0x1,
+0xF,0xF,0x0,0xF,0xF,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1E,0xC,0x0,0x2,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x44,0x44,0x44,0x44,0x44,0x44,0x0,0x0,0x0,
+0x22,0x17,0x41,0x0,0x32,0x36,
+};
+
+const unsigned char WS_WARM[159] PROGMEM =
+{
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x80,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+0x10,0x66,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xF,0x6,0x0,0x0,0x0,0x0,0x1,
+0x8,0x8,0x0,0x8,0x8,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xF,0x6,0x0,0x1,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x44,0x44,0x44,0x44,0x44,0x44,0x0,0x0,0x0,
+0x22,0x17,0x41,0x0,0x32,0x36,
+};
+
+const unsigned char _WF_PARTIAL_COLD[159] PROGMEM =
+{
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x14,0x0,0x0,0x0,0x0,0x0,0x2,
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x22,0x17,0x41,0xB0,0x32,0x36,
+};
+
+const unsigned char _WF_PARTIAL_COOL[159] PROGMEM =
+{
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xF,0x0,0x0,0x0,0x0,0x0,0x2,
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x22,0x17,0x41,0xB0,0x32,0x36,
+};
+
+const unsigned char _WF_PARTIAL_WARM[159] PROGMEM =
+{
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x80,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x40,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x8,0x0,0x0,0x0,0x0,0x0,0x2,
+0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x22,0x22,0x22,0x22,0x22,0x22,0x0,0x0,0x0,
+0x22,0x17,0x41,0xB0,0x32,0x36,
+};
+
+#endif
+
+/* waveforms by temperature band, coldest first */
+struct EpdWaveform {
+    signed char min_temp;           /* lowest temperature of the band, C */
+    const unsigned char* full;
+    const unsigned char* partial;
+};
+
+static const EpdWaveform waveforms[] = {
+#if EPD_TEMPERATURE_BANDS
+    {-128, WS_COLD, _WF_PARTIAL_COLD},
+    {10, WS_COOL, _WF_PARTIAL_COOL},
+    {20, WS_20_30, _WF_PARTIAL_2IN9},
+    {26, WS_WARM, _WF_PARTIAL_WARM},
+#else
+    {-128, WS_20_30, _WF_PARTIAL_2IN9},
+#endif
+};
+
+#define WAVEFORM_COUNT  (int)(sizeof(waveforms) / sizeof(waveforms[0]))
+#define WAVEFORM_ROOM   (EPD_TEMPERATURE_BANDS ? 2 : 0)
+
 Epd::~Epd() {
 };
 
 Epd::Epd() {
-    reset_pin = RST_PIN;
-    dc_pin = DC_PIN;
-    cs_pin = CS_PIN;
-    busy_pin = BUSY_PIN;
     width = EPD_WIDTH;
     height = EPD_HEIGHT;
+    current_lut = NULL;
+    partial_session = false;
+    busy_pending = false;
+    stream_row_bytes = 0;
+    waveform = WAVEFORM_ROOM;
 };
 
 int Epd::Init() {
@@ -94,9 +259,7 @@ int Epd::Init() {
 	Reset();
 	
     /* EPD hardware init start */
-	WaitUntilIdle();   
 	SendCommand(0x12);  //SWRESET
-	WaitUntilIdle();   
 	
 	SendCommand(0x01); //Driver output control      
 	SendData(0x27);
@@ -113,31 +276,90 @@ int Epd::Init() {
 	SendData(0x80);	
 
 	SetMemoryPointer(0, 0);
-	WaitUntilIdle();
 
-    SetLut_by_host(WS_20_30);
+    SetLut_by_host(waveforms[waveform].full);
     /* EPD hardware init end */
     return 0;
 }
 
 /**
- *  @brief: basic function for sending commands
+ *  @brief: basic function for sending commands.
+ *          waits first if the last reset, SWRESET (0x12) or master
+ *          activation (0x20) may still hold BUSY, the only commands
+ *          that start a busy period. nothing else waits.
  */
 void Epd::SendCommand(unsigned char command) {
-    DigitalWrite(dc_pin, LOW);
-    DigitalWrite(cs_pin, LOW);
+    if (busy_pending) {
+        WaitUntilIdle();
+    }
+    SpiWait();
+    dc_pin.Write(LOW);
     SpiTransfer(command);
-    DigitalWrite(cs_pin, HIGH);
+    if (command == 0x12 || command == 0x20) {
+        busy_pending = true;
+    }
 }
 
 /**
  *  @brief: basic function for sending data
  */
 void Epd::SendData(unsigned char data) {
-    DigitalWrite(dc_pin, HIGH);
-    DigitalWrite(cs_pin, LOW);
+    SpiWait();
+    dc_pin.Write(HIGH);
     SpiTransfer(data);
-    DigitalWrite(cs_pin, HIGH);
+}
+
+/**
+ *  @brief: send a RAM buffer as one data payload.
+ *          DC and CS are asserted once for the whole block
+ *          instead of once per byte. the transfer may still be
+ *          running when this returns, see WaitTransfer().
+ */
+void Epd::SendDataBlock(const unsigned char* data, unsigned int len) {
+    SpiWait();
+    dc_pin.Write(HIGH);
+    SpiTransferBlock(data, len);
+}
+
+/**
+ *  @brief: same as SendDataBlock but reads the buffer from flash
+ */
+void Epd::SendDataBlock_P(const unsigned char* data, unsigned int len) {
+    SpiWait();
+    dc_pin.Write(HIGH);
+    SpiTransferBlock_P(data, len);
+}
+
+/**
+ *  @brief: send the same data byte len times as one payload
+ */
+void Epd::SendDataRepeat(unsigned char data, unsigned int len) {
+    SpiWait();
+    dc_pin.Write(HIGH);
+    SpiTransferRepeat(data, len);
+}
+
+/**
+ *  @brief: send len bytes decoded from a PackBits stream in flash
+ *          as one data payload, see tools/imgpack.py
+ */
+void Epd::SendDataPackBits_P(const unsigned char* packed_data, unsigned int len) {
+    SpiWait();
+    dc_pin.Write(HIGH);
+    SpiTransferPackBits_P(packed_data, len);
+}
+
+/**
+ *  @brief: wait for a RAM upload still running in the background.
+ *          SendDataBlock(), SendFrameRows() and the SetFrameMemory,
+ *          SetFrameMemory_Partial and SetFrameMemory_Base overloads
+ *          taking a RAM buffer can return while the buffer is still
+ *          being read; call this before changing it. the flash, repeat
+ *          and PackBits uploads are done when they return, and the
+ *          next command waits for the upload anyway.
+ */
+void Epd::WaitTransfer(void) {
+    SpiWait();
 }
 
 /**
@@ -145,11 +367,11 @@ void Epd::SendData(unsigned char data) {
  */
 void Epd::WaitUntilIdle(void) {
 	while(1) {	 //=1 BUSY
-		if(DigitalRead(busy_pin)==LOW) 
+		if(busy_pin.Read()==LOW) 
 			break;
 		DelayMs(5);
 	}
-	DelayMs(5);
+	busy_pending = false;
 }
 
 /**
@@ -158,12 +380,15 @@ void Epd::WaitUntilIdle(void) {
  *          see Epd::Sleep();
  */
 void Epd::Reset(void) {
-    DigitalWrite(reset_pin, HIGH);
+    reset_pin.Write(HIGH);
     DelayMs(20);  
-    DigitalWrite(reset_pin, LOW);                //module reset    
+    reset_pin.Write(LOW);                //module reset    
     DelayMs(5);
-    DigitalWrite(reset_pin, HIGH); 
+    reset_pin.Write(HIGH); 
     DelayMs(20);  
+    current_lut = NULL;
+    partial_session = false;
+    busy_pending = true;
 }
 
 /**
@@ -204,11 +429,7 @@ void Epd::SetFrameMemory(
     SetMemoryPointer(x, y);
     SendCommand(0x24);
     /* send the image data */
-    for (int j = 0; j < y_end - y + 1; j++) {
-        for (int i = 0; i < (x_end - x + 1) / 8; i++) {
-            SendData(image_buffer[i + j * (image_width / 8)]);
-        }
-    }
+    SendImageData(image_buffer, (x_end - x + 1) / 8, y_end - y + 1, image_width / 8);
 }
 void Epd::SetFrameMemory_Partial(
     const unsigned char* image_buffer,
@@ -241,41 +462,114 @@ void Epd::SetFrameMemory_Partial(
         y_end = y + image_height - 1;
     }
 
-    DigitalWrite(reset_pin, LOW);
-    DelayMs(2);
-    DigitalWrite(reset_pin, HIGH);
-    DelayMs(2);
-	
-	SetLut(_WF_PARTIAL_2IN9);
-	SendCommand(0x37); 
-	SendData(0x00);  
-	SendData(0x00);  
-	SendData(0x00);  
-	SendData(0x00); 
-	SendData(0x00);  	
-	SendData(0x40);  
-	SendData(0x00);  
-	SendData(0x00);   
-	SendData(0x00);  
-	SendData(0x00);
-
-	SendCommand(0x3C); //BorderWavefrom
-	SendData(0x80);	
+    if (!partial_session) {
+        InitPartial();
+    }
 
-	SendCommand(0x22); 
-	SendData(0xC0);   
-	SendCommand(0x20); 
-	WaitUntilIdle();  
-	
     SetMemoryArea(x, y, x_end, y_end);
     SetMemoryPointer(x, y);
     SendCommand(0x24);
     /* send the image data */
-    for (int j = 0; j < y_end - y + 1; j++) {
-        for (int i = 0; i < (x_end - x + 1) / 8; i++) {
-            SendData(image_buffer[i + j * (image_width / 8)]);
-        }
+    SendImageData(image_buffer, (x_end - x + 1) / 8, y_end - y + 1, image_width / 8);
+}
+
+/**
+ *  @brief: open a window in the frame memory (0x24) and leave it in
+ *          the data phase, so the window can be filled a few rows at
+ *          a time with SendFrameRows(). the controller's address
+ *          counter carries on from one call to the next, so the
+ *          caller only needs a buffer for the rows it is sending.
+ *          this won't update the display.
+ */
+void Epd::BeginFrameStream_Partial(int x, int y, int image_width, int image_height) {
+    int x_end;
+    int y_end;
+
+    stream_row_bytes = 0;
+    if (x < 0 || image_width < 0 || y < 0 || image_height < 0) {
+        return;
     }
+    /* x point must be the multiple of 8 or the last 3 bits will be ignored */
+    x &= 0xF8;
+    image_width &= 0xF8;
+    if (x + image_width >= this->width) {
+        x_end = this->width - 1;
+    } else {
+        x_end = x + image_width - 1;
+    }
+    if (y + image_height >= this->height) {
+        y_end = this->height - 1;
+    } else {
+        y_end = y + image_height - 1;
+    }
+
+    if (!partial_session) {
+        InitPartial();
+    }
+
+    SetMemoryArea(x, y, x_end, y_end);
+    SetMemoryPointer(x, y);
+    SendCommand(0x24);
+    stream_row_bytes = (x_end - x + 1) / 8;
+}
+
+/**
+ *  @brief: send the next rows of the window opened by
+ *          BeginFrameStream_Partial(). image_width is the width of
+ *          the buffer, rows wider than the window are clipped.
+ */
+void Epd::SendFrameRows(const unsigned char* image_buffer, int image_width, int rows) {
+    if (image_buffer == NULL) {
+        return;
+    }
+    SendImageData(image_buffer, stream_row_bytes, rows, image_width / 8);
+}
+
+/**
+ *  @brief: put an image buffer to both frame memories (0x24 and 0x26),
+ *          like SetFrameMemory_Base but for a window from RAM.
+ *          used for content that stays on screen across partial updates.
+ *          this won't update the display.
+ */
+void Epd::SetFrameMemory_Base(
+    const unsigned char* image_buffer,
+    int x,
+    int y,
+    int image_width,
+    int image_height
+) {
+    int x_end;
+    int y_end;
+
+    if (
+        image_buffer == NULL ||
+        x < 0 || image_width < 0 ||
+        y < 0 || image_height < 0
+    ) {
+        return;
+    }
+    /* x point must be the multiple of 8 or the last 3 bits will be ignored */
+    x &= 0xF8;
+    image_width &= 0xF8;
+    if (x + image_width >= this->width) {
+        x_end = this->width - 1;
+    } else {
+        x_end = x + image_width - 1;
+    }
+    if (y + image_height >= this->height) {
+        y_end = this->height - 1;
+    } else {
+        y_end = y + image_height - 1;
+    }
+    SetMemoryArea(x, y, x_end, y_end);
+    SetMemoryPointer(x, y);
+    SendCommand(0x24);
+    /* send the image data */
+    SendImageData(image_buffer, (x_end - x + 1) / 8, y_end - y + 1, image_width / 8);
+    SetMemoryPointer(x, y);
+    SendCommand(0x26);
+    /* send the image data */
+    SendImageData(image_buffer, (x_end - x + 1) / 8, y_end - y + 1, image_width / 8);
 }
 
 /**
@@ -300,23 +594,31 @@ void Epd::SetFrameMemory(const unsigned char* image_buffer) {
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
     /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    SendDataBlock_P(image_buffer, this->width / 8 * this->height);
 }
 void Epd::SetFrameMemory_Base(const unsigned char* image_buffer) {
     SetMemoryArea(0, 0, this->width - 1, this->height - 1);
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
     /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    SendDataBlock_P(image_buffer, this->width / 8 * this->height);
     SendCommand(0x26);
     /* send the image data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(pgm_read_byte(&image_buffer[i]));
-    }
+    SendDataBlock_P(image_buffer, this->width / 8 * this->height);
+}
+
+/**
+ *  @brief: like SetFrameMemory_Base, for a full-screen PackBits image
+ *          in flash (see tools/imgpack.py). the image is decoded
+ *          straight onto SPI, nothing is buffered.
+ */
+void Epd::SetFrameMemory_Base_PackBits(const unsigned char* packed_image) {
+    SetMemoryArea(0, 0, this->width - 1, this->height - 1);
+    SetMemoryPointer(0, 0);
+    SendCommand(0x24);
+    SendDataPackBits_P(packed_image, this->width / 8 * this->height);
+    SendCommand(0x26);
+    SendDataPackBits_P(packed_image, this->width / 8 * this->height);
 }
 
 /**
@@ -328,9 +630,47 @@ void Epd::ClearFrameMemory(unsigned char color) {
     SetMemoryPointer(0, 0);
     SendCommand(0x24);
     /* send the color data */
-    for (int i = 0; i < this->width / 8 * this->height; i++) {
-        SendData(color);
+    SendDataRepeat(color, this->width / 8 * this->height);
+}
+
+/**
+ *  @brief: clear both frame memories (0x24 and 0x26) with the specified color.
+ *          this won't update the display.
+ */
+void Epd::ClearFrameMemory_Base(unsigned char color) {
+    SetMemoryArea(0, 0, this->width - 1, this->height - 1);
+    SetMemoryPointer(0, 0);
+    SendCommand(0x24);
+    SendDataRepeat(color, this->width / 8 * this->height);
+    SetMemoryPointer(0, 0);
+    SendCommand(0x26);
+    SendDataRepeat(color, this->width / 8 * this->height);
+}
+
+/**
+ *  @brief: start a partial refresh session, or carry on with the open one.
+ *          the module reset, partial LUT and border setup are done
+ *          once per session, so each SetFrameMemory_Partial inside it
+ *          only sets the window and sends the RAM data. a session
+ *          lasts across any number of DisplayFrame_Partial() calls,
+ *          until a full update, Init(), Sleep() or EndPartial(). in an
+ *          open session this only loads the partial LUT again if
+ *          SetTemperature() picked another band.
+ */
+void Epd::BeginPartial(void) {
+    if (partial_session) {
+        SetLut(waveforms[waveform].partial);
+        return;
     }
+    InitPartial();
+    partial_session = true;
+}
+
+/**
+ *  @brief: close the session, the next BeginPartial() resets the module
+ */
+void Epd::EndPartial(void) {
+    partial_session = false;
 }
 
 /**
@@ -341,39 +681,128 @@ void Epd::ClearFrameMemory(unsigned char color) {
  *          set the other memory area.
  */
 void Epd::DisplayFrame(void) {
+    StartDisplayFrame();
+    WaitUntilIdle();
+}
+
+void Epd::DisplayFrame_Partial(void) {
+    StartDisplayFrame_Partial();
+    WaitUntilIdle();
+}
+
+/**
+ *  @brief: start a display update and return without waiting.
+ *          poll IsBusy() and don't send anything else to the
+ *          module until it returns false.
+ */
+void Epd::StartDisplayFrame(void) {
+    /* a full update switches the clock and analog off again */
+    partial_session = false;
     SendCommand(0x22);
     SendData(0xc7);
     SendCommand(0x20);
-    WaitUntilIdle();
 }
 
-void Epd::DisplayFrame_Partial(void) {
+void Epd::StartDisplayFrame_Partial(void) {
     SendCommand(0x22);
     SendData(0x0F);
     SendCommand(0x20);
-    WaitUntilIdle();
 }
 
-void Epd::SetLut(unsigned char *lut) {       
-	unsigned char count;
+/**
+ *  @brief: true while the module is still busy with an update
+ */
+bool Epd::IsBusy(void) {
+    if (busy_pin.Read() == HIGH) {
+        return true;
+    }
+    busy_pending = false;
+    return false;
+}
+
+/**
+ *  @brief: load a waveform LUT.
+ *          the last loaded LUT is remembered, so loading the same
+ *          one again is a no-op until the next reset. true if it
+ *          was sent.
+ */
+bool Epd::SetLut(const unsigned char *lut) {
+	if (lut == current_lut) {
+		return false;
+	}
 	SendCommand(0x32);
-	for(count=0; count<153; count++) 
-		SendData(lut[count]); 
-	WaitUntilIdle();
+	SendDataBlock_P(lut, 153);
+	current_lut = lut;
+	return true;
 }
 
-void Epd::SetLut_by_host(unsigned char *lut) {
-    SetLut((unsigned char *)lut);
+/**
+ *  @brief: load a full update LUT and the voltages stored after it
+ */
+void Epd::SetLut_by_host(const unsigned char *lut) {
+	if (!SetLut(lut)) {
+		return;
+	}
 	SendCommand(0x3f);
-	SendData(*(lut+153));
+	SendData(pgm_read_byte(lut+153));
 	SendCommand(0x03);	// gate voltage
-	SendData(*(lut+154));
+	SendData(pgm_read_byte(lut+154));
 	SendCommand(0x04);	// source voltage
-	SendData(*(lut+155));	// VSH
-	SendData(*(lut+156));	// VSH2
-	SendData(*(lut+157));	// VSL
+	SendData(pgm_read_byte(lut+155));	// VSH
+	SendData(pgm_read_byte(lut+156));	// VSH2
+	SendData(pgm_read_byte(lut+157));	// VSL
 	SendCommand(0x2c);		// VCOM
-	SendData(*(lut+158));
+	SendData(pgm_read_byte(lut+158));
+}
+
+/**
+ *  @brief: pick the waveforms for the panel temperature, in C.
+ *          the band only changes once the temperature is a degree
+ *          past its edge, so a reading hovering on an edge doesn't
+ *          reload the LUT every update. takes effect at the next
+ *          Init() or BeginPartial(). without EPD_TEMPERATURE_BANDS
+ *          there is only the one band.
+ */
+void Epd::SetTemperature(int celsius) {
+    while (waveform + 1 < WAVEFORM_COUNT && celsius >= waveforms[waveform + 1].min_temp + 1) {
+        waveform++;
+    }
+    while (waveform > 0 && celsius < waveforms[waveform].min_temp - 1) {
+        waveform--;
+    }
+}
+
+/**
+ *  @brief: private function to prepare the module for partial updates.
+ *          the reset pulse clears the loaded LUT.
+ */
+void Epd::InitPartial(void) {
+    reset_pin.Write(LOW);
+    DelayMs(2);
+    reset_pin.Write(HIGH);
+    DelayMs(2);
+    current_lut = NULL;
+    busy_pending = true;
+	
+	SetLut(waveforms[waveform].partial);
+	SendCommand(0x37); 
+	SendData(0x00);  
+	SendData(0x00);  
+	SendData(0x00);  
+	SendData(0x00); 
+	SendData(0x00);  	
+	SendData(0x40);  
+	SendData(0x00);  
+	SendData(0x00);   
+	SendData(0x00);  
+	SendData(0x00);
+
+	SendCommand(0x3C); //BorderWavefrom
+	SendData(0x80);	
+
+	SendCommand(0x22); 
+	SendData(0xC0);   
+	SendCommand(0x20); 
 }
 
 /**
@@ -401,18 +830,40 @@ void Epd::SetMemoryPointer(int x, int y) {
     SendCommand(0x4F);
     SendData(y & 0xFF);
     SendData((y >> 8) & 0xFF);
-    WaitUntilIdle();
+}
+
+/**
+ *  @brief: private function to send a window of image data.
+ *          rows are sent as a single block when the window spans
+ *          the full buffer width, otherwise one block per row.
+ */
+void Epd::SendImageData(const unsigned char* image_buffer, int row_bytes, int rows, int stride) {
+    if (row_bytes <= 0 || rows <= 0) {
+        return;
+    }
+    if (row_bytes == stride) {
+        SendDataBlock(image_buffer, row_bytes * rows);
+        return;
+    }
+    for (int j = 0; j < rows; j++) {
+        SendDataBlock(&image_buffer[j * stride], row_bytes);
+    }
 }
 
 /**
  *  @brief: After this command is transmitted, the chip would enter the 
  *          deep-sleep mode to save power. 
  *          The deep sleep mode would return to standby by hardware reset. 
- *          You can use Epd::Init() to awaken
+ *          You can use Epd::Init() to awaken, or BeginPartial() whose
+ *          reset pulse also ends deep sleep.
+ *          keep_ram picks mode 1, which keeps both RAM planes, over
+ *          mode 2, which loses them.
  */
-void Epd::Sleep() {
+void Epd::Sleep(bool keep_ram) {
+    /* waking takes a reset, which ends the session */
+    partial_session = false;
     SendCommand(0x10);
-    SendData(0x01);
+    SendData(keep_ram ? 0x01 : 0x03);
     // WaitUntilIdle();
 }
 
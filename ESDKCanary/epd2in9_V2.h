@@ -33,6 +33,13 @@
 #define EPD_WIDTH       128
 #define EPD_HEIGHT      296
 
+// Waveforms for cold, cool and warm rooms beside the stock 20-30 C
+// ones, picked by SetTemperature(). They are untuned starting points,
+// so the stock waveforms are used at every temperature unless this is 1.
+#ifndef EPD_TEMPERATURE_BANDS
+#define EPD_TEMPERATURE_BANDS 0
+#endif
+
 class Epd : EpdIf {
 public:
     unsigned long width;
@@ -43,7 +50,12 @@ public:
     int  Init();
     void SendCommand(unsigned char command);
     void SendData(unsigned char data);
+    void SendDataBlock(const unsigned char* data, unsigned int len);
+    void SendDataBlock_P(const unsigned char* data, unsigned int len);
+    void SendDataRepeat(unsigned char data, unsigned int len);
+    void SendDataPackBits_P(const unsigned char* packed_data, unsigned int len);
     void WaitUntilIdle(void);
+    void WaitTransfer(void);
     void Reset(void);
     void SetFrameMemory(
         const unsigned char* image_buffer,
@@ -59,23 +71,43 @@ public:
         int image_width,
         int image_height
     );
+    void BeginFrameStream_Partial(int x, int y, int image_width, int image_height);
+    void SendFrameRows(const unsigned char* image_buffer, int image_width, int rows);
     void SetFrameMemory(const unsigned char* image_buffer);
     void SetFrameMemory_Base(const unsigned char* image_buffer);
+    void SetFrameMemory_Base_PackBits(const unsigned char* packed_image);
+    void SetFrameMemory_Base(
+        const unsigned char* image_buffer,
+        int x,
+        int y,
+        int image_width,
+        int image_height
+    );
     void ClearFrameMemory(unsigned char color);
+    void ClearFrameMemory_Base(unsigned char color);
+    void BeginPartial(void);
+    void EndPartial(void);
     void DisplayFrame(void);
 	void DisplayFrame_Partial(void);
-    void Sleep(void);
+    void StartDisplayFrame(void);
+    void StartDisplayFrame_Partial(void);
+    bool IsBusy(void);
+    void SetTemperature(int celsius);
+    void Sleep(bool keep_ram = true);
 
 private:
-    unsigned int reset_pin;
-    unsigned int dc_pin;
-    unsigned int cs_pin;
-    unsigned int busy_pin;
+    const unsigned char* current_lut;
+    bool partial_session;
+    bool busy_pending;
+    int stream_row_bytes;
+    int waveform;
 		
-	void SetLut(unsigned char *lut);
-    void SetLut_by_host(unsigned char *lut);
+	void InitPartial(void);
+	bool SetLut(const unsigned char *lut);
+    void SetLut_by_host(const unsigned char *lut);
     void SetMemoryArea(int x_start, int y_start, int x_end, int y_end);
     void SetMemoryPointer(int x, int y);
+    void SendImageData(const unsigned char* image_buffer, int row_bytes, int rows, int stride);
 };
 
 #endif /* EPD2IN9_V2_H */
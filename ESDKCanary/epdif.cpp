@@ -26,30 +26,156 @@
  */
 
 #include "epdif.h"
+#include "packbits.h"
 #include <SPI.h>
 
+EpdPin EpdIf::reset_pin(RST_PIN);
+EpdPin EpdIf::dc_pin(DC_PIN);
+EpdPin EpdIf::cs_pin(CS_PIN);
+EpdPin EpdIf::busy_pin(BUSY_PIN);
+SpiBusClient EpdIf::bus(SPISettings(EPD_SPI_CLOCK, MSBFIRST, SPI_MODE0), EPD_SPI_BURST);
+unsigned int EpdIf::burst_bytes = 0;
+
+#if EPD_ASYNC && defined(ARDUINO_ARCH_SAMD)
+static EpdDmaTransport default_transport;
+#elif EPD_ASYNC && !defined(ARDUINO)
+static EpdHostTransport default_transport(EPD_SPI_CLOCK);
+#else
+static EpdBlockingTransport default_transport;
+#endif
+EpdTransport* EpdIf::transport = &default_transport;
+
+#if defined(ARDUINO_ARCH_SAMD)
+EpdPin::EpdPin(int pin) {
+    port = &PORT->Group[g_APinDescription[pin].ulPort];
+    mask = 1ul << g_APinDescription[pin].ulPin;
+}
+#elif defined(__AVR__)
+EpdPin::EpdPin(int pin) {
+    out = portOutputRegister(digitalPinToPort(pin));
+    in = portInputRegister(digitalPinToPort(pin));
+    mask = digitalPinToBitMask(pin);
+}
+#else
+EpdPin::EpdPin(int pin) : pin(pin) {
+}
+#endif
+
 EpdIf::EpdIf() {
 };
 
 EpdIf::~EpdIf() {
 };
 
-void EpdIf::DigitalWrite(int pin, int value) {
-    digitalWrite(pin, value);
+void EpdIf::DelayMs(unsigned int delaytime) {
+    delay(delaytime);
 }
 
-int EpdIf::DigitalRead(int pin) {
-    return digitalRead(pin);
+/**
+ *  @brief: take the bus, unless single bytes still hold it, and assert
+ *          CS for one burst once a background upload has finished
+ */
+void EpdIf::SpiBegin(void) {
+    transport->Wait();
+    spiBus.acquire(bus);
+    cs_pin.Write(LOW);
+    burst_bytes = 0;
 }
 
-void EpdIf::DelayMs(unsigned int delaytime) {
-    delay(delaytime);
+void EpdIf::SpiEnd(void) {
+    cs_pin.Write(HIGH);
+    spiBus.release(bus);
+}
+
+/**
+ *  @brief: send one byte of a burst. once EPD_SPI_BURST bytes have gone
+ *          out the bus is handed over and taken back; the panel keeps
+ *          its RAM pointer across the CS pulse.
+ */
+inline void EpdIf::SpiSend(unsigned char data) {
+    if (burst_bytes == bus.maxBurst && bus.maxBurst) {
+        SpiEnd();
+        spiBus.handOver(bus);
+        SpiBegin();
+    }
+    SPI.transfer(data);
+    burst_bytes++;
 }
 
+/**
+ *  @brief: send one byte with CS pulsed around it. the bus is taken by
+ *          the first byte of a run and kept, so a command and its data
+ *          pay for one acquire; the next burst or another client's
+ *          acquire() gives it up.
+ */
 void EpdIf::SpiTransfer(unsigned char data) {
-    digitalWrite(CS_PIN, LOW);
+    transport->Wait();
+    spiBus.acquire(bus);
+    cs_pin.Write(LOW);
     SPI.transfer(data);
-    digitalWrite(CS_PIN, HIGH);
+    cs_pin.Write(HIGH);
+}
+
+/**
+ *  @brief: stream a RAM buffer with CS held low, in bursts of at most
+ *          bus.maxBurst bytes. with a background transport this returns
+ *          before the transfer is done; data must be left alone until
+ *          the next SpiWait() or transfer.
+ */
+void EpdIf::SpiTransferBlock(const unsigned char* data, unsigned int len) {
+    transport->StartSend(data, len);
+}
+
+/**
+ *  @brief: wait for a background upload to finish. DC must not change
+ *          while one is running.
+ */
+void EpdIf::SpiWait(void) {
+    transport->Wait();
+}
+
+/**
+ *  @brief: same as SpiTransferBlock but reads the buffer from flash
+ */
+void EpdIf::SpiTransferBlock_P(const unsigned char* data, unsigned int len) {
+    SpiBegin();
+    while (len--) {
+        SpiSend(pgm_read_byte(data++));
+    }
+    SpiEnd();
+}
+
+/**
+ *  @brief: send the same byte len times with CS held low
+ */
+void EpdIf::SpiTransferRepeat(unsigned char data, unsigned int len) {
+    SpiBegin();
+    while (len--) {
+        SpiSend(data);
+    }
+    SpiEnd();
+}
+
+/**
+ *  @brief: decode len bytes of a PackBits stream in flash onto SPI
+ *          with CS held low, see packbits.h
+ */
+void EpdIf::SpiTransferPackBits_P(const unsigned char* packed_data, unsigned int len) {
+    struct SpiSink {
+        void copy_P(const unsigned char* src, unsigned int count) {
+            while (count--) {
+                SpiSend(pgm_read_byte(src++));
+            }
+        }
+        void fill(unsigned char data, unsigned int count) {
+            while (count--) {
+                SpiSend(data);
+            }
+        }
+    } sink;
+    SpiBegin();
+    PackBitsDecode_P(packed_data, len, sink);
+    SpiEnd();
 }
 
 int EpdIf::IfInit(void) {
@@ -57,8 +183,174 @@ int EpdIf::IfInit(void) {
     pinMode(RST_PIN, OUTPUT);
     pinMode(DC_PIN, OUTPUT);
     pinMode(BUSY_PIN, INPUT); 
-    SPI.begin();
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+    /* transactions are per burst, see SpiBegin() */
+    spiBus.begin();
+    transport->Begin();
     return 0;
 }
 
+
+void EpdTransport::StartSend(const unsigned char* data, unsigned int len) {
+    Wait();
+    if (len == 0) {
+        return;
+    }
+    next = data;
+    left = len;
+    NextChunk();
+    if (!Background()) {
+        Wait();
+    }
+}
+
+/**
+ *  @brief: steps the transfer, true while it is still going
+ */
+bool EpdTransport::Busy(void) {
+    if (!active || !ChunkDone()) {
+        return active;
+    }
+    EndChunk();
+    EpdIf::cs_pin.Write(HIGH);
+    spiBus.release(EpdIf::bus);
+    if (left == 0) {
+        active = false;
+        return false;
+    }
+    spiBus.handOver(EpdIf::bus);
+    NextChunk();
+    return true;
+}
+
+void EpdTransport::Wait(void) {
+    while (Busy()) {
+        yield();
+    }
+}
+
+void EpdTransport::NextChunk(void) {
+    unsigned int len = left;
+    if (EpdIf::bus.maxBurst && len > EpdIf::bus.maxBurst) {
+        len = EpdIf::bus.maxBurst;
+    }
+    const unsigned char* data = next;
+    next += len;
+    left -= len;
+    active = true;
+    spiBus.acquire(EpdIf::bus);
+    EpdIf::cs_pin.Write(LOW);
+    StartChunk(data, len);
+}
+
+void EpdBlockingTransport::StartChunk(const unsigned char* data, unsigned int len) {
+    while (len--) {
+        SPI.transfer(*data++);
+    }
+}
+
+#if defined(ARDUINO_ARCH_SAMD)
+static DmacDescriptor dma_descriptors[EPD_DMA_CHANNEL + 1] __attribute__((aligned(16)));
+static DmacDescriptor dma_writeback[EPD_DMA_CHANNEL + 1] __attribute__((aligned(16)));
+
+void EpdDmaTransport::Begin(void) {
+    if (ready) {
+        return;
+    }
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+    if (DMAC->CTRL.reg & DMAC_CTRL_DMAENABLE) {
+        /* someone else set up the descriptor tables */
+        return;
+    }
+    DMAC->BASEADDR.reg = (uint32_t)dma_descriptors;
+    DMAC->WRBADDR.reg = (uint32_t)dma_writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(EPD_DMA_CHANNEL);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_ENABLE) {
+    }
+    /* the channel registers ignore writes until the reset is done */
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (DMAC->CHCTRLA.reg & DMAC_CHCTRLA_SWRST) {
+    }
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) |
+                        DMAC_CHCTRLB_TRIGSRC(EPD_DMA_TRIGGER) |
+                        DMAC_CHCTRLB_TRIGACT_BEAT;
+    interrupts();
+    ready = true;
+}
+
+void EpdDmaTransport::StartChunk(const unsigned char* data, unsigned int len) {
+    if (!ready) {
+        while (len--) {
+            SPI.transfer(*data++);
+        }
+        return;
+    }
+    DmacDescriptor& d = dma_descriptors[EPD_DMA_CHANNEL];
+    d.BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE |
+                   DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_BLOCKACT_NOACT;
+    d.BTCNT.reg = len;
+    d.SRCADDR.reg = (uint32_t)(data + len);  /* end address when incrementing */
+    d.DSTADDR.reg = (uint32_t)&EPD_DMA_SERCOM->SPI.DATA.reg;
+    d.DESCADDR.reg = 0;
+    EPD_DMA_SERCOM->SPI.INTFLAG.reg = SERCOM_SPI_INTFLAG_TXC;
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(EPD_DMA_CHANNEL);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    interrupts();
+}
+
+bool EpdDmaTransport::ChunkDone(void) {
+    if (!ready) {
+        return true;
+    }
+    noInterrupts();
+    DMAC->CHID.reg = DMAC_CHID_ID(EPD_DMA_CHANNEL);
+    bool done = DMAC->CHINTFLAG.reg & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR);
+    interrupts();
+    return done;
+}
+
+/**
+ *  @brief: the DMAC is done once the last byte is in the SERCOM, so
+ *          wait for it to shift out, then drop what was received
+ */
+void EpdDmaTransport::EndChunk(void) {
+    if (!ready) {
+        return;
+    }
+    while (!(EPD_DMA_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_TXC)) {
+    }
+    while (EPD_DMA_SERCOM->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_RXC) {
+        (void)EPD_DMA_SERCOM->SPI.DATA.reg;
+    }
+    EPD_DMA_SERCOM->SPI.STATUS.reg = SERCOM_SPI_STATUS_BUFOVF;
+}
+#endif
+
+#if !defined(ARDUINO)
+void EpdHostTransport::StartChunk(const unsigned char* data, unsigned int len) {
+    this->data = data;
+    this->len = len;
+    started = micros();
+}
+
+bool EpdHostTransport::ChunkDone(void) {
+    if (micros() - started < len * 8UL * 1000 / (clock / 1000)) {
+        return false;
+    }
+    unsigned char scratch[32];
+    while (len > 0) {
+        unsigned int n = len < sizeof(scratch) ? len : sizeof(scratch);
+        memcpy(scratch, data, n);
+        SPI.transfer(scratch, n);
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+#endif
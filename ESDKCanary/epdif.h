@@ -29,6 +29,7 @@
 #define EPDIF_H
 
 #include <Arduino.h>
+#include "spibus.h"
 
 // Pin definition
 //#define RST_PIN         8
@@ -41,16 +42,186 @@
 #define CS_PIN          8
 #define BUSY_PIN        5
 
+// SSD1680 write clock, capped at 12 MHz by the SAMD21 core
+#define EPD_SPI_CLOCK   20000000
+// bytes sent before a long upload hands the bus to other clients
+#define EPD_SPI_BURST   512
+
+// RAM uploads run in the background where there is a backend for it,
+// see EpdTransport. 0 keeps every transfer blocking.
+#ifndef EPD_ASYNC
+#if defined(ARDUINO_ARCH_SAMD) || !defined(ARDUINO)
+#define EPD_ASYNC       1
+#else
+#define EPD_ASYNC       0
+#endif
+#endif
+
+#if defined(ARDUINO_ARCH_SAMD)
+// DMAC channel, and the SERCOM behind SPI with its TX trigger
+#ifndef EPD_DMA_CHANNEL
+#define EPD_DMA_CHANNEL 0
+#endif
+#ifndef EPD_DMA_SERCOM
+#define EPD_DMA_SERCOM  SERCOM1
+#define EPD_DMA_TRIGGER SERCOM1_DMAC_ID_TX
+#endif
+#endif
+
+/**
+ *  @brief: a control pin resolved once, when it is constructed, to a
+ *          port register and bit mask, so Write() is a single store
+ *          instead of a digitalWrite() pin table lookup per call.
+ *          cores without a backend here, and the host mock, go through
+ *          digitalWrite()/digitalRead().
+ */
+class EpdPin {
+public:
+    EpdPin(int pin);
+#if defined(ARDUINO_ARCH_SAMD)
+    inline void Write(int value) {
+        if (value) {
+            port->OUTSET.reg = mask;
+        } else {
+            port->OUTCLR.reg = mask;
+        }
+    }
+    inline int Read(void) { return (port->IN.reg & mask) ? HIGH : LOW; }
+private:
+    PortGroup* port;
+    uint32_t mask;
+#elif defined(__AVR__)
+    /* the port is shared with other pins, so mask interrupts around the read-modify-write */
+    inline void Write(int value) {
+        uint8_t sreg = SREG;
+        cli();
+        if (value) {
+            *out |= mask;
+        } else {
+            *out &= ~mask;
+        }
+        SREG = sreg;
+    }
+    inline int Read(void) { return (*in & mask) ? HIGH : LOW; }
+private:
+    volatile uint8_t* out;
+    volatile uint8_t* in;
+    uint8_t mask;
+#else
+    inline void Write(int value) { digitalWrite(pin, value); }
+    inline int Read(void) { return digitalRead(pin); }
+private:
+    int pin;
+#endif
+};
+
+/**
+ *  @brief: moves RAM buffers to the panel for SpiTransferBlock().
+ *          StartSend() returns once the transfer is under way and the
+ *          buffer must not change until Busy() returns false. long
+ *          transfers go out in bursts of bus.maxBurst bytes with the
+ *          bus handed over in between; backends move one burst at a
+ *          time with CS already asserted.
+ */
+class EpdTransport {
+public:
+    virtual void Begin(void) {}
+    void StartSend(const unsigned char* data, unsigned int len);
+    bool Busy(void);
+    void Wait(void);
+
+protected:
+    virtual bool Background(void) { return false; }
+    virtual void StartChunk(const unsigned char* data, unsigned int len) = 0;
+    virtual bool ChunkDone(void) { return true; }
+    virtual void EndChunk(void) {}
+
+private:
+    const unsigned char* next = NULL;
+    unsigned int left = 0;
+    bool active = false;
+    void NextChunk(void);
+};
+
+/**
+ *  @brief: SPI.transfer() a byte at a time, returns when done
+ */
+class EpdBlockingTransport : public EpdTransport {
+protected:
+    void StartChunk(const unsigned char* data, unsigned int len);
+};
+
+#if defined(ARDUINO_ARCH_SAMD)
+/**
+ *  @brief: feeds the SERCOM from a DMAC channel while the CPU carries on.
+ *          completion is polled, so no DMAC interrupt handler is taken.
+ *          falls back to blocking if another library owns the DMAC.
+ */
+class EpdDmaTransport : public EpdTransport {
+public:
+    void Begin(void);
+
+protected:
+    bool Background(void) { return ready; }
+    void StartChunk(const unsigned char* data, unsigned int len);
+    bool ChunkDone(void);
+    void EndChunk(void);
+
+private:
+    bool ready = false;
+};
+#endif
+
+#if !defined(ARDUINO)
+/**
+ *  @brief: host model of a background transfer for tests on Linux. a
+ *          burst completes once len bytes would have gone out at the
+ *          bus clock; its bytes are read from the buffer only then, so
+ *          a buffer reused too early shows up in the panel RAM.
+ */
+class EpdHostTransport : public EpdTransport {
+public:
+    EpdHostTransport(unsigned long clock) : clock(clock) {}
+
+protected:
+    bool Background(void) { return true; }
+    void StartChunk(const unsigned char* data, unsigned int len);
+    bool ChunkDone(void);
+
+private:
+    unsigned long clock;
+    const unsigned char* data = NULL;
+    unsigned int len = 0;
+    unsigned long started = 0;
+};
+#endif
+
 class EpdIf {
 public:
     EpdIf(void);
     ~EpdIf(void);
 
     static int  IfInit(void);
-    static void DigitalWrite(int pin, int value); 
-    static int  DigitalRead(int pin);
     static void DelayMs(unsigned int delaytime);
     static void SpiTransfer(unsigned char data);
+    static void SpiTransferBlock(const unsigned char* data, unsigned int len);
+    static void SpiTransferBlock_P(const unsigned char* data, unsigned int len);
+    static void SpiTransferRepeat(unsigned char data, unsigned int len);
+    static void SpiTransferPackBits_P(const unsigned char* packed_data, unsigned int len);
+    static void SpiWait(void);
+
+    static EpdPin reset_pin;
+    static EpdPin dc_pin;
+    static EpdPin cs_pin;
+    static EpdPin busy_pin;
+    static SpiBusClient bus;
+    static EpdTransport* transport;
+
+private:
+    static unsigned int burst_bytes;
+    static void SpiBegin(void);
+    static void SpiEnd(void);
+    static void SpiSend(unsigned char data);
 };
 
 #endif
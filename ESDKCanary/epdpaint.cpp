@@ -24,8 +24,96 @@
  * THE SOFTWARE.
  */
 
-#include <avr/pgmspace.h>
-#include "epdpaint.h"
+#include <string.h>
+#include "basicpaint.h"
+
+/* calls PaintKernel<rotate>::call for the runtime rotation */
+#define PAINT_DISPATCH(call)                                            \
+    switch (this->rotate) {                                             \
+    case ROTATE_0:   PaintKernel<ROTATE_0>::call;   break;              \
+    case ROTATE_90:  PaintKernel<ROTATE_90>::call;  break;              \
+    case ROTATE_180: PaintKernel<ROTATE_180>::call; break;              \
+    case ROTATE_270: PaintKernel<ROTATE_270>::call; break;              \
+    }
+
+/**
+ *  @brief: clear the image
+ */
+void PaintSpans::Clear(unsigned char* image, int width, int height, int colored) {
+    bool set = IF_INVERT_COLOR ? colored : !colored;
+    memset(image, set ? 0xFF : 0x00, width / 8 * height);
+}
+
+/**
+ *  @brief: this fills a rectangle by absolute coordinates (inclusive).
+ *          each row is a span: a masked leading byte, whole bytes in
+ *          the middle and a masked trailing byte.
+ */
+void PaintSpans::FillAbsoluteRect(unsigned char* image, int width, int height,
+                                  int x0, int y0, int x1, int y1, int colored) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > width - 1) x1 = width - 1;
+    if (y1 > height - 1) y1 = height - 1;
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    bool set = IF_INVERT_COLOR ? colored : !colored;
+    int b0 = x0 / 8;
+    int b1 = x1 / 8;
+    unsigned char lead = 0xFF >> (x0 % 8);
+    unsigned char trail = 0xFF << (7 - x1 % 8);
+    if (b0 == b1) {
+        lead &= trail;
+    }
+    unsigned char* row = &image[y0 * (width / 8)];
+    for (int y = y0; y <= y1; y++, row += width / 8) {
+        if (set) {
+            row[b0] |= lead;
+        } else {
+            row[b0] &= ~lead;
+        }
+        if (b0 == b1) {
+            continue;
+        }
+        memset(&row[b0 + 1], set ? 0xFF : 0x00, b1 - b0 - 1);
+        if (set) {
+            row[b1] |= trail;
+        } else {
+            row[b1] &= ~trail;
+        }
+    }
+}
+
+/**
+ *  @brief: finds the stored rows of a glyph. returns false for chars
+ *          missing from a subset font.
+ */
+bool PaintSpans::FindGlyph(sFONT* font, char ascii_char, PaintGlyph* glyph) {
+    int row_bytes = font->Width / 8 + (font->Width % 8 ? 1 : 0);
+    unsigned int slot = ascii_char - ' ';
+    if (font->index) {
+        if (slot > '~' - ' ' || (slot = pgm_read_byte(&font->index[slot])) == 0xFF) {
+            return false;
+        }
+    }
+    if (font->glyphs) {
+        sGLYPH g;
+        memcpy_P(&g, &font->glyphs[slot], sizeof(g));
+        glyph->data = &font->table[g.offset];
+        glyph->left = g.left;
+        glyph->top = g.top;
+        glyph->bottom = g.top + g.height - 1;
+        glyph->data_bytes = g.width / 8 + (g.width % 8 ? 1 : 0);
+    } else {
+        glyph->data = &font->table[slot * font->Height * row_bytes];
+        glyph->left = 0;
+        glyph->top = 0;
+        glyph->bottom = font->Height - 1;
+        glyph->data_bytes = row_bytes;
+    }
+    return true;
+}
 
 Paint::Paint(unsigned char* image, int width, int height) {
     this->rotate = ROTATE_0;
@@ -42,11 +130,7 @@ Paint::~Paint() {
  *  @brief: clear the image
  */
 void Paint::Clear(int colored) {
-    for (int x = 0; x < this->width; x++) {
-        for (int y = 0; y < this->height; y++) {
-            DrawAbsolutePixel(x, y, colored);
-        }
-    }
+    PaintSpans::Clear(this->image, this->width, this->height, colored);
 }
 
 /**
@@ -54,22 +138,7 @@ void Paint::Clear(int colored) {
  *          this function won't be affected by the rotate parameter.
  */
 void Paint::DrawAbsolutePixel(int x, int y, int colored) {
-    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
-        return;
-    }
-    if (IF_INVERT_COLOR) {
-        if (colored) {
-            image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
-        } else {
-            image[(x + y * this->width) / 8] &= ~(0x80 >> (x % 8));
-        }
-    } else {
-        if (colored) {
-            image[(x + y * this->width) / 8] &= ~(0x80 >> (x % 8));
-        } else {
-            image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
-        }
-    }
+    PaintSpans::DrawAbsolutePixel(this->image, this->width, this->height, x, y, colored);
 }
 
 /**
@@ -107,112 +176,43 @@ void Paint::SetRotate(int rotate){
  *  @brief: this draws a pixel by the coordinates
  */
 void Paint::DrawPixel(int x, int y, int colored) {
-    int point_temp;
-    if (this->rotate == ROTATE_0) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-            return;
-        }
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_90) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
-        }
-        point_temp = x;
-        x = this->width - y;
-        y = point_temp;
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_180) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-          return;
-        }
-        x = this->width - x;
-        y = this->height - y;
-        DrawAbsolutePixel(x, y, colored);
-    } else if (this->rotate == ROTATE_270) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
-        }
-        point_temp = x;
-        x = y;
-        y = this->height - point_temp;
-        DrawAbsolutePixel(x, y, colored);
-    }
+    PAINT_DISPATCH(DrawPixel(this->image, this->width, this->height, x, y, colored));
 }
 
 /**
  *  @brief: this draws a charactor on the frame buffer but not refresh
  */
 void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored) {
-    int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
-
-    for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
-            if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
-                DrawPixel(x + i, y + j, colored);
-            }
-            if (i % 8 == 7) {
-                ptr++;
-            }
-        }
-        if (font->Width % 8 != 0) {
-            ptr++;
-        }
-    }
+    PAINT_DISPATCH(DrawCharAt(this->image, this->width, this->height, x, y, ascii_char, font, colored));
 }
 
 /**
 *  @brief: this displays a string on the frame buffer but not refresh
 */
 void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored) {
-    const char* p_text = text;
-    unsigned int counter = 0;
-    int refcolumn = x;
-    
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        /* Display one character on EPD */
-        DrawCharAt(refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
-        refcolumn += font->Width;
-        /* Point on the next character */
-        p_text++;
-        counter++;
-    }
+    PAINT_DISPATCH(DrawStringAt(this->image, this->width, this->height, x, y, text, font, colored));
+}
+
+/**
+*  @brief: this displays a string scale times its font size
+*/
+void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colored, int scale) {
+    PAINT_DISPATCH(DrawStringScaled(this->image, this->width, this->height, x, y, text, font, colored, scale));
 }
 
 /**
 *  @brief: this draws a line on the frame buffer
 */
 void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
-    /* Bresenham algorithm */
-    int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while((x0 != x1) && (y0 != y1)) {
-        DrawPixel(x0, y0 , colored);
-        if (2 * err >= dy) {     
-            err += dy;
-            x0 += sx;
-        }
-        if (2 * err <= dx) {
-            err += dx; 
-            y0 += sy;
-        }
-    }
+    PAINT_DISPATCH(DrawLine(this->image, this->width, this->height, x0, y0, x1, y1, colored));
 }
 
 /**
 *  @brief: this draws a horizontal line on the frame buffer
 */
 void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored) {
-    int i;
-    for (i = x; i < x + line_width; i++) {
-        DrawPixel(i, y, colored);
+    if (line_width > 0) {
+        PAINT_DISPATCH(FillRect(this->image, this->width, this->height, x, y, x + line_width - 1, y, colored));
     }
 }
 
@@ -220,9 +220,8 @@ void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored) {
 *  @brief: this draws a vertical line on the frame buffer
 */
 void Paint::DrawVerticalLine(int x, int y, int line_height, int colored) {
-    int i;
-    for (i = y; i < y + line_height; i++) {
-        DrawPixel(x, i, colored);
+    if (line_height > 0) {
+        PAINT_DISPATCH(FillRect(this->image, this->width, this->height, x, y, x, y + line_height - 1, colored));
     }
 }
 
@@ -230,16 +229,7 @@ void Paint::DrawVerticalLine(int x, int y, int line_height, int colored) {
 *  @brief: this draws a rectangle
 */
 void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored) {
-    int min_x, min_y, max_x, max_y;
-    min_x = x1 > x0 ? x0 : x1;
-    max_x = x1 > x0 ? x1 : x0;
-    min_y = y1 > y0 ? y0 : y1;
-    max_y = y1 > y0 ? y1 : y0;
-    
-    DrawHorizontalLine(min_x, min_y, max_x - min_x + 1, colored);
-    DrawHorizontalLine(min_x, max_y, max_x - min_x + 1, colored);
-    DrawVerticalLine(min_x, min_y, max_y - min_y + 1, colored);
-    DrawVerticalLine(max_x, min_y, max_y - min_y + 1, colored);
+    PAINT_DISPATCH(DrawRectangle(this->image, this->width, this->height, x0, y0, x1, y1, colored));
 }
 
 /**
@@ -247,96 +237,26 @@ void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored) {
 */
 void Paint::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored) {
     int min_x, min_y, max_x, max_y;
-    int i;
     min_x = x1 > x0 ? x0 : x1;
     max_x = x1 > x0 ? x1 : x0;
     min_y = y1 > y0 ? y0 : y1;
     max_y = y1 > y0 ? y1 : y0;
     
-    for (i = min_x; i <= max_x; i++) {
-      DrawVerticalLine(i, min_y, max_y - min_y + 1, colored);
-    }
+    PAINT_DISPATCH(FillRect(this->image, this->width, this->height, min_x, min_y, max_x, max_y, colored));
 }
 
 /**
 *  @brief: this draws a circle
 */
 void Paint::DrawCircle(int x, int y, int radius, int colored) {
-    /* Bresenham algorithm */
-    int x_pos = -radius;
-    int y_pos = 0;
-    int err = 2 - 2 * radius;
-    int e2;
-
-    do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
-        e2 = err;
-        if (e2 <= y_pos) {
-            err += ++y_pos * 2 + 1;
-            if(-x_pos == y_pos && e2 <= x_pos) {
-              e2 = 0;
-            }
-        }
-        if (e2 > x_pos) {
-            err += ++x_pos * 2 + 1;
-        }
-    } while (x_pos <= 0);
+    PAINT_DISPATCH(DrawCircle(this->image, this->width, this->height, x, y, radius, colored, false));
 }
 
 /**
 *  @brief: this draws a filled circle
 */
 void Paint::DrawFilledCircle(int x, int y, int radius, int colored) {
-    /* Bresenham algorithm */
-    int x_pos = -radius;
-    int y_pos = 0;
-    int err = 2 - 2 * radius;
-    int e2;
-
-    do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
-        DrawHorizontalLine(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
-        DrawHorizontalLine(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
-        e2 = err;
-        if (e2 <= y_pos) {
-            err += ++y_pos * 2 + 1;
-            if(-x_pos == y_pos && e2 <= x_pos) {
-                e2 = 0;
-            }
-        }
-        if(e2 > x_pos) {
-            err += ++x_pos * 2 + 1;
-        }
-    } while(x_pos <= 0);
+    PAINT_DISPATCH(DrawCircle(this->image, this->width, this->height, x, y, radius, colored, true));
 }
 
 /* END OF FILE */
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
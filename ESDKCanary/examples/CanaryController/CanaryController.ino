@@ -124,7 +124,7 @@ void setup() {
   myCanary.StartPos(WINGS_DOWN);
   Serial.println("Wings down");
 
-  delay(5000);
+  waitFor(5000);
 }
 
 void loop() {
@@ -160,12 +160,17 @@ void loop() {
     doDemo();
   }
 
+  // Refreshes run in the background - keep stepping the display
+  epd.pollDisplay();
+
   if (updateDisplayFlag) {
     updateDisplayFlag = false;
     epd.updateDisplay();
   }
 
   myCanary.updateState();
+  // Wing gestures run in the background too
+  myCanary.tick(millis());
 }
 
 void doDemo() {
@@ -185,7 +190,16 @@ void doDemo() {
     myCanary.co2 = co2_array[i];
     epd.updateDisplay();
     myCanary.updateState();
-    delay(5000);
+    waitFor(5000);
+  }
+}
+
+// Delay that keeps the display refresh and the wings moving
+void waitFor(unsigned long ms) {
+  unsigned long start = millis();
+  while (millis() - start < ms) {
+    epd.pollDisplay();
+    myCanary.tick(millis());
   }
 }
 
@@ -77,6 +77,7 @@ void setup() {
   pwm.setOscillatorFrequency(27000000);
   pwm.setPWMFreq(SERVO_FREQ);  // Analog servos run at ~50 Hz updates
   myCanary.StartPos(WINGS_DOWN);
+  finishMotion();
   Serial.println("Servo initialised");
 
   Serial.println("Servo test");
@@ -88,6 +89,7 @@ void loop() {
   myCanary.Tweet(STUFFY_TRACK, audioOn);
   Serial.println("Flapping...");
   myCanary.Flap(WINGS_DOWN, WINGS_UP_A_BIT, VSLOW, 3);
+  finishMotion();
   // Displays pulse length at end of movement
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
@@ -95,32 +97,44 @@ void loop() {
   myCanary.Tweet(OPEN_WINDOW_TRACK, audioOn);
   Serial.println("Flapping frantically...");
   myCanary.Flap(WINGS_DOWN, WINGS_UP_A_LOT, FAST, 4);
+  finishMotion();
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
 
   myCanary.Tweet(PASS_OUT_TRACK, audioOn);
   Serial.println("Passing out...");
   myCanary.PassOut(PASS_OUT_POS, FAST);
+  finishMotion();
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
 
   myCanary.Tweet(THATS_BETTER_TRACK, audioOn);
   Serial.println("Returning to start...");
   myCanary.StartPos(WINGS_DOWN);
+  finishMotion();
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
 
   myCanary.Tweet(DEAD_TRACK, audioOn);
   Serial.println("Dead...");
   myCanary.Dead(DEAD_POS, VFAST);
+  finishMotion();
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
 
   Serial.println("Returning to start...");
   myCanary.StartPos(WINGS_DOWN);
+  finishMotion();
   Serial.println(myCanary.getPulselen());
   delay(TIME_DELAY);
 
   Serial.println("Press reset to repeat test");
   while (1);
 }
+
+// Runs the queued gesture to the end
+void finishMotion() {
+  while (myCanary.isMoving()) {
+    myCanary.tick(millis());
+  }
+}
@@ -1380,6 +1380,9 @@ sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  0, /* Rotate */
+  NULL, /* index */
+  NULL, /* glyphs */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
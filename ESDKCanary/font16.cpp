@@ -1760,6 +1760,9 @@ sFONT Font16 = {
   Font16_Table,
   11, /* Width */
   16, /* Height */
+  0, /* Rotate */
+  NULL, /* index */
+  NULL, /* glyphs */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -2138,6 +2138,9 @@ sFONT Font20 = {
   Font20_Table,
   14, /* Width */
   20, /* Height */
+  0, /* Rotate */
+  NULL, /* index */
+  NULL, /* glyphs */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -2516,6 +2516,9 @@ sFONT Font24 = {
   Font24_Table,
   17, /* Width */
   24, /* Height */
+  0, /* Rotate */
+  NULL, /* index */
+  NULL, /* glyphs */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
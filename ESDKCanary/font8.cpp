@@ -1000,6 +1000,9 @@ sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  0, /* Rotate */
+  NULL, /* index */
+  NULL, /* glyphs */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
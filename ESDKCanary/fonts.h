@@ -47,10 +47,23 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+/* Bounding box of one glyph in a trimmed font. The table holds rows
+   top..top+height-1, each (width+7)/8 bytes with bit 7 at column left */
+struct sGLYPH {
+  uint16_t offset;
+  uint8_t left;
+  uint8_t top;
+  uint8_t width;
+  uint8_t height;
+};
+
 struct sFONT {
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  uint8_t Rotate;   /* ROTATE_* the glyphs are stored in, 0 if not set */
+  const uint8_t *index;  /* subset fonts: glyph slot per char from ' ', 0xFF = none */
+  const sGLYPH *glyphs;  /* trimmed fonts: bounding box per glyph slot */
 };
 
 extern sFONT Font24;
@@ -59,6 +72,11 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+/* Subsets generated by tools/fontgen.py, see fonts_rot180.cpp */
+extern sFONT Font24_Rot180;
+extern sFONT Font20_Rot180;
+extern sFONT Font16_Rot180;
+
 #endif /* __FONTS_H */
  
 
@@ -0,0 +1,799 @@
+/**
+ *  @filename   :   fonts_rot180.cpp
+ *  @brief      :   Fonts for Paint, stored rotated by 180 degrees.
+ *                  Generated by tools/fontgen.py - do not edit:
+ *                  tools/fontgen.py --trim --rotate 180 -o ESDKCanary/fonts_rot180.cpp 24:CO2TEMPRHV '20:0123456789.%CpmPM' 16:ACDGJMPWacdefilmnoprtuy:
+ */
+
+#include <avr/pgmspace.h>
+#include "epdpaint.h"
+#include "fonts.h"
+
+const uint8_t Font24_Rot180_Table[] PROGMEM =
+{
+	// @0 '2' (11 pixels wide)
+	0xFF, 0xE0, //###########
+	0xFF, 0xE0, //###########
+	0x00, 0xC0, //        ##
+	0x01, 0x80, //       ##
+	0x03, 0x00, //      ##
+	0x0E, 0x00, //    ###
+	0x1C, 0x00, //   ###
+	0x30, 0x00, //  ##
+	0x60, 0x00, // ##
+	0xC0, 0x00, //##
+	0xC0, 0x60, //##       ##
+	0xC0, 0x60, //##       ##
+	0x60, 0xE0, // ##     ###
+	0x7F, 0xC0, // #########
+	0x1F, 0x00, //   #####
+
+	// @30 'C' (12 pixels wide)
+	0x3F, 0x00, //  ######
+	0x7F, 0xC0, // #########
+	0xE0, 0xE0, //###     ###
+	0xC0, 0x60, //##       ##
+	0x00, 0x30, //          ##
+	0x00, 0x30, //          ##
+	0x00, 0x30, //          ##
+	0x00, 0x30, //          ##
+	0x00, 0x30, //          ##
+	0xC0, 0x30, //##        ##
+	0xC0, 0x60, //##       ##
+	0xE0, 0xE0, //###     ###
+	0xFF, 0xC0, //##########
+	0xDF, 0x00, //## #####
+
+	// @58 'E' (12 pixels wide)
+	0xFF, 0xF0, //############
+	0xFF, 0xF0, //############
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0xCC, 0xC0, //##  ##  ##
+	0x0C, 0xC0, //    ##  ##
+	0x0F, 0xC0, //    ######
+	0x0F, 0xC0, //    ######
+	0x0C, 0xC0, //    ##  ##
+	0xCC, 0xC0, //##  ##  ##
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0xFF, 0xF0, //############
+	0xFF, 0xF0, //############
+
+	// @86 'H' (14 pixels wide)
+	0xFC, 0xFC, //######  ######
+	0xFC, 0xFC, //######  ######
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x3F, 0xF0, //  ##########
+	0x3F, 0xF0, //  ##########
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0xFC, 0xFC, //######  ######
+	0xFC, 0xFC, //######  ######
+
+	// @114 'M' (16 pixels wide)
+	0xFE, 0x7F, //#######  #######
+	0xFE, 0x7F, //#######  #######
+	0x30, 0x0C, //  ##        ##
+	0x30, 0x0C, //  ##        ##
+	0x31, 0x8C, //  ##   ##   ##
+	0x33, 0xCC, //  ##  ####  ##
+	0x33, 0xCC, //  ##  ####  ##
+	0x36, 0x6C, //  ## ##  ## ##
+	0x36, 0x6C, //  ## ##  ## ##
+	0x3C, 0x3C, //  ####    ####
+	0x3C, 0x3C, //  ####    ####
+	0x38, 0x1C, //  ###      ###
+	0xF8, 0x1F, //#####      #####
+	0xF0, 0x0F, //####        ####
+
+	// @142 'O' (12 pixels wide)
+	0x0F, 0x00, //    ####
+	0x3F, 0xC0, //  ########
+	0x70, 0xE0, // ###    ###
+	0x60, 0x60, // ##      ##
+	0xE0, 0x70, //###      ###
+	0xC0, 0x30, //##        ##
+	0xC0, 0x30, //##        ##
+	0xC0, 0x30, //##        ##
+	0xC0, 0x30, //##        ##
+	0xE0, 0x70, //###      ###
+	0x60, 0x60, // ##      ##
+	0x70, 0xE0, // ###    ###
+	0x3F, 0xC0, //  ########
+	0x0F, 0x00, //    ####
+
+	// @170 'P' (12 pixels wide)
+	0x0F, 0xF0, //    ########
+	0x0F, 0xF0, //    ########
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0x1F, 0xC0, //   #######
+	0x7F, 0xC0, // #########
+	0x60, 0xC0, // ##     ##
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0xE0, 0xC0, //###     ##
+	0x7F, 0xF0, // ###########
+	0x3F, 0xF0, //  ##########
+
+	// @198 'R' (14 pixels wide)
+	0xE1, 0xFC, //###    #######
+	0xF1, 0xFC, //####   #######
+	0x38, 0x30, //  ###     ##
+	0x18, 0x30, //   ##     ##
+	0x1C, 0x30, //   ###    ##
+	0x0E, 0x30, //    ###   ##
+	0x07, 0xF0, //     #######
+	0x1F, 0xF0, //   #########
+	0x38, 0x30, //  ###     ##
+	0x30, 0x30, //  ##      ##
+	0x30, 0x30, //  ##      ##
+	0x38, 0x30, //  ###     ##
+	0x1F, 0xFC, //   ###########
+	0x0F, 0xFC, //    ##########
+
+	// @226 'T' (12 pixels wide)
+	0x3F, 0xC0, //  ########
+	0x3F, 0xC0, //  ########
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0xC6, 0x30, //##   ##   ##
+	0xC6, 0x30, //##   ##   ##
+	0xC6, 0x30, //##   ##   ##
+	0xC6, 0x30, //##   ##   ##
+	0xFF, 0xF0, //############
+	0xFF, 0xF0, //############
+
+	// @254 'V' (15 pixels wide)
+	0x01, 0x00, //       #
+	0x03, 0x80, //      ###
+	0x03, 0x80, //      ###
+	0x06, 0xC0, //     ## ##
+	0x06, 0xC0, //     ## ##
+	0x06, 0xC0, //     ## ##
+	0x0C, 0x60, //    ##   ##
+	0x0C, 0x60, //    ##   ##
+	0x18, 0x30, //   ##     ##
+	0x18, 0x30, //   ##     ##
+	0x18, 0x30, //   ##     ##
+	0x30, 0x18, //  ##       ##
+	0xFE, 0xFE, //####### #######
+	0xFE, 0xFE, //####### #######
+};
+
+/* offset, left, top, width, height */
+const sGLYPH Font24_Rot180_Glyphs[] PROGMEM =
+{
+	{0, 4, 7, 11, 15}, // '2'
+	{30, 3, 7, 12, 14}, // 'C'
+	{58, 4, 7, 12, 14}, // 'E'
+	{86, 2, 7, 14, 14}, // 'H'
+	{114, 1, 7, 16, 14}, // 'M'
+	{142, 3, 7, 12, 14}, // 'O'
+	{170, 3, 7, 12, 14}, // 'P'
+	{198, 2, 7, 14, 14}, // 'R'
+	{226, 3, 7, 12, 14}, // 'T'
+	{254, 1, 7, 15, 14}, // 'V'
+};
+
+/* glyph slot for each char from ' ', 0xFF = not in the font */
+const uint8_t Font24_Rot180_Index[] PROGMEM =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0x05,
+	0x06, 0xFF, 0x07, 0xFF, 0x08, 0xFF, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+sFONT Font24_Rot180 = {
+  Font24_Rot180_Table,
+  17, /* Width */
+  24, /* Height */
+  ROTATE_180, /* Rotate */
+  Font24_Rot180_Index,
+  Font24_Rot180_Glyphs,
+};
+
+const uint8_t Font20_Rot180_Table[] PROGMEM =
+{
+	// @0 '%' (9 pixels wide)
+	0x70, 0x00, // ###
+	0x88, 0x00, //#   #
+	0x88, 0x00, //#   #
+	0x88, 0x00, //#   #
+	0x71, 0x80, // ###   ##
+	0x07, 0x80, //     ####
+	0x3E, 0x00, //  #####
+	0xF0, 0x00, //####
+	0xC7, 0x00, //##   ###
+	0x08, 0x80, //    #   #
+	0x08, 0x80, //    #   #
+	0x08, 0x80, //    #   #
+	0x07, 0x00, //     ###
+
+	// @26 '.' (3 pixels wide)
+	0xE0, //###
+	0xE0, //###
+	0xE0, //###
+
+	// @29 '0' (9 pixels wide)
+	0x3E, 0x00, //  #####
+	0x7F, 0x00, // #######
+	0x63, 0x00, // ##   ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0x63, 0x00, // ##   ##
+	0x7F, 0x00, // #######
+	0x3E, 0x00, //  #####
+
+	// @55 '1' (8 pixels wide)
+	0xFF, //########
+	0xFF, //########
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x1F, //   #####
+	0x1F, //   #####
+	0x18, //   ##
+
+	// @68 '2' (9 pixels wide)
+	0xFF, 0x80, //#########
+	0xFF, 0x80, //#########
+	0x03, 0x00, //      ##
+	0x06, 0x00, //     ##
+	0x0C, 0x00, //    ##
+	0x18, 0x00, //   ##
+	0x30, 0x00, //  ##
+	0x60, 0x00, // ##
+	0xC0, 0x00, //##
+	0xC1, 0x80, //##     ##
+	0xE3, 0x80, //###   ###
+	0x7F, 0x00, // #######
+	0x3E, 0x00, //  #####
+
+	// @94 '3' (10 pixels wide)
+	0x3F, 0x80, //  #######
+	0x7F, 0xC0, // #########
+	0xE0, 0xC0, //###     ##
+	0xC0, 0x00, //##
+	0xC0, 0x00, //##
+	0xE0, 0x00, //###
+	0x7C, 0x00, // #####
+	0x7C, 0x00, // #####
+	0xE0, 0x00, //###
+	0xC0, 0x00, //##
+	0xE1, 0x80, //###    ##
+	0x7F, 0x80, // ########
+	0x3E, 0x00, //  #####
+
+	// @120 '4' (9 pixels wide)
+	0xF8, 0x00, //#####
+	0xF8, 0x00, //#####
+	0x60, 0x00, // ##
+	0xFF, 0x80, //#########
+	0xFF, 0x80, //#########
+	0x61, 0x80, // ##    ##
+	0x63, 0x00, // ##   ##
+	0x66, 0x00, // ##  ##
+	0x66, 0x00, // ##  ##
+	0x6C, 0x00, // ## ##
+	0x78, 0x00, // ####
+	0x78, 0x00, // ####
+	0x70, 0x00, // ###
+
+	// @146 '5' (9 pixels wide)
+	0x3F, 0x00, //  ######
+	0x7F, 0x80, // ########
+	0xE1, 0x80, //###    ##
+	0xC0, 0x00, //##
+	0xC0, 0x00, //##
+	0xC0, 0x00, //##
+	0xE3, 0x00, //###   ##
+	0x7F, 0x00, // #######
+	0x3F, 0x00, //  ######
+	0x03, 0x00, //      ##
+	0x03, 0x00, //      ##
+	0x7F, 0x00, // #######
+	0x7F, 0x00, // #######
+
+	// @172 '6' (9 pixels wide)
+	0x3C, 0x00, //  ####
+	0x7F, 0x00, // #######
+	0xE3, 0x00, //###   ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xE3, 0x80, //###   ###
+	0x7F, 0x80, // ########
+	0x3D, 0x80, //  #### ##
+	0x03, 0x80, //      ###
+	0x03, 0x00, //      ##
+	0x0F, 0x00, //    ####
+	0xFE, 0x00, //#######
+	0xF8, 0x00, //#####
+
+	// @198 '7' (9 pixels wide)
+	0x18, 0x00, //   ##
+	0x18, 0x00, //   ##
+	0x18, 0x00, //   ##
+	0x30, 0x00, //  ##
+	0x30, 0x00, //  ##
+	0x30, 0x00, //  ##
+	0x60, 0x00, // ##
+	0x60, 0x00, // ##
+	0x60, 0x00, // ##
+	0xC0, 0x00, //##
+	0xC1, 0x80, //##     ##
+	0xFF, 0x80, //#########
+	0xFF, 0x80, //#########
+
+	// @224 '8' (9 pixels wide)
+	0x3E, 0x00, //  #####
+	0x7F, 0x00, // #######
+	0xE3, 0x80, //###   ###
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xE3, 0x80, //###   ###
+	0x7F, 0x00, // #######
+	0x7F, 0x00, // #######
+	0xE3, 0x80, //###   ###
+	0xC1, 0x80, //##     ##
+	0xE3, 0x80, //###   ###
+	0x7F, 0x00, // #######
+	0x3E, 0x00, //  #####
+
+	// @250 '9' (9 pixels wide)
+	0x0F, 0x80, //    #####
+	0x3F, 0x80, //  #######
+	0x78, 0x00, // ####
+	0x60, 0x00, // ##
+	0xE0, 0x00, //###
+	0xDE, 0x00, //## ####
+	0xFF, 0x00, //########
+	0xE3, 0x80, //###   ###
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0x63, 0x80, // ##   ###
+	0x7F, 0x00, // #######
+	0x1E, 0x00, //   ####
+
+	// @276 'C' (10 pixels wide)
+	0x3E, 0x00, //  #####
+	0x7F, 0x00, // #######
+	0xE3, 0x80, //###   ###
+	0xC1, 0xC0, //##     ###
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0xC1, 0xC0, //##     ###
+	0xE3, 0x80, //###   ###
+	0xFF, 0x00, //########
+	0xDE, 0x00, //## ####
+
+	// @300 'M' (12 pixels wide)
+	0xF9, 0xF0, //#####  #####
+	0xF9, 0xF0, //#####  #####
+	0x60, 0x60, // ##      ##
+	0x66, 0x60, // ##  ##  ##
+	0x66, 0x60, // ##  ##  ##
+	0x6F, 0x60, // ## #### ##
+	0x6F, 0x60, // ## #### ##
+	0x69, 0x60, // ## #  # ##
+	0x79, 0xE0, // ####  ####
+	0x70, 0xE0, // ###    ###
+	0xF0, 0xF0, //####    ####
+	0xF0, 0xF0, //####    ####
+
+	// @324 'P' (10 pixels wide)
+	0x0F, 0xC0, //    ######
+	0x0F, 0xC0, //    ######
+	0x01, 0x80, //       ##
+	0x01, 0x80, //       ##
+	0x3F, 0x80, //  #######
+	0x7F, 0x80, // ########
+	0xE1, 0x80, //###    ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xE1, 0x80, //###    ##
+	0x7F, 0xC0, // #########
+	0x3F, 0xC0, //  ########
+
+	// @348 'm' (12 pixels wide)
+	0xEE, 0xF0, //### ### ####
+	0xEE, 0xF0, //### ### ####
+	0x66, 0x60, // ##  ##  ##
+	0x66, 0x60, // ##  ##  ##
+	0x66, 0x60, // ##  ##  ##
+	0x66, 0x60, // ##  ##  ##
+	0x66, 0x60, // ##  ##  ##
+	0x7F, 0xF0, // ###########
+	0x3B, 0xF0, //  ### ######
+
+	// @366 'p' (11 pixels wide)
+	0x03, 0xE0, //      #####
+	0x03, 0xE0, //      #####
+	0x00, 0xC0, //        ##
+	0x00, 0xC0, //        ##
+	0x1E, 0xC0, //   #### ##
+	0x7F, 0xC0, // #########
+	0x61, 0xC0, // ##    ###
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0xC0, 0xC0, //##      ##
+	0x61, 0xC0, // ##    ###
+	0x7F, 0xE0, // ##########
+	0x1E, 0xE0, //   #### ###
+};
+
+/* offset, left, top, width, height */
+const sGLYPH Font20_Rot180_Glyphs[] PROGMEM =
+{
+	{0, 3, 6, 9, 13}, // '%'
+	{26, 5, 6, 3, 3}, // '.'
+	{29, 3, 6, 9, 13}, // '0'
+	{55, 3, 6, 8, 13}, // '1'
+	{68, 3, 6, 9, 13}, // '2'
+	{94, 3, 6, 10, 13}, // '3'
+	{120, 3, 6, 9, 13}, // '4'
+	{146, 3, 6, 9, 13}, // '5'
+	{172, 3, 6, 9, 13}, // '6'
+	{198, 3, 6, 9, 13}, // '7'
+	{224, 3, 6, 9, 13}, // '8'
+	{250, 3, 6, 9, 13}, // '9'
+	{276, 2, 6, 10, 12}, // 'C'
+	{300, 1, 6, 12, 12}, // 'M'
+	{324, 2, 6, 10, 12}, // 'P'
+	{348, 1, 6, 12, 9}, // 'm'
+	{366, 2, 2, 11, 13}, // 'p'
+};
+
+/* glyph slot for each char from ' ', 0xFF = not in the font */
+const uint8_t Font20_Rot180_Index[] PROGMEM =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
+	0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xFF, 0xFF,
+	0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+	0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+sFONT Font20_Rot180 = {
+  Font20_Rot180_Table,
+  14, /* Width */
+  20, /* Height */
+  ROTATE_180, /* Rotate */
+  Font20_Rot180_Index,
+  Font20_Rot180_Glyphs,
+};
+
+const uint8_t Font16_Rot180_Table[] PROGMEM =
+{
+	// @0 ':' (2 pixels wide)
+	0xC0, //##
+	0xC0, //##
+	0x00, //
+	0x00, //
+	0x00, //
+	0xC0, //##
+	0xC0, //##
+
+	// @7 'A' (10 pixels wide)
+	0xF3, 0xC0, //####  ####
+	0x61, 0x80, // ##    ##
+	0x61, 0x80, // ##    ##
+	0x3F, 0x00, //  ######
+	0x33, 0x00, //  ##  ##
+	0x33, 0x00, //  ##  ##
+	0x12, 0x00, //   #  #
+	0x1E, 0x00, //   ####
+	0x1F, 0x80, //   ######
+
+	// @25 'C' (9 pixels wide)
+	0x3E, 0x00, //  #####
+	0x43, 0x00, // #    ##
+	0x81, 0x80, //#      ##
+	0x01, 0x80, //       ##
+	0x01, 0x80, //       ##
+	0x01, 0x80, //       ##
+	0x81, 0x80, //#      ##
+	0xC3, 0x00, //##    ##
+	0xBE, 0x00, //# #####
+
+	// @43 'D' (9 pixels wide)
+	0x3F, 0x80, //  #######
+	0x63, 0x00, // ##   ##
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0x63, 0x00, // ##   ##
+	0x3F, 0x80, //  #######
+
+	// @61 'G' (9 pixels wide)
+	0x3E, 0x00, //  #####
+	0x63, 0x00, // ##   ##
+	0x61, 0x80, // ##    ##
+	0xF9, 0x80, //#####  ##
+	0x01, 0x80, //       ##
+	0x01, 0x80, //       ##
+	0x41, 0x80, // #     ##
+	0x63, 0x00, // ##   ##
+	0x5E, 0x00, // # ####
+
+	// @79 'J' (9 pixels wide)
+	0x1F, 0x00, //   #####
+	0x31, 0x80, //  ##   ##
+	0x31, 0x80, //  ##   ##
+	0x31, 0x80, //  ##   ##
+	0x30, 0x00, //  ##
+	0x30, 0x00, //  ##
+	0x30, 0x00, //  ##
+	0x30, 0x00, //  ##
+	0xFE, 0x00, //#######
+
+	// @97 'M' (11 pixels wide)
+	0xFB, 0xE0, //##### #####
+	0x60, 0xC0, // ##     ##
+	0x64, 0xC0, // ##  #  ##
+	0x6E, 0xC0, // ## ### ##
+	0x6A, 0xC0, // ## # # ##
+	0x7B, 0xC0, // #### ####
+	0x71, 0xC0, // ###   ###
+	0x60, 0xC0, // ##     ##
+	0xE0, 0xE0, //###     ###
+
+	// @115 'P' (8 pixels wide)
+	0x3F, //  ######
+	0x06, //     ##
+	0x06, //     ##
+	0x7E, // ######
+	0xC6, //##   ##
+	0xC6, //##   ##
+	0xC6, //##   ##
+	0xC6, //##   ##
+	0x7F, // #######
+
+	// @124 'W' (11 pixels wide)
+	0x31, 0x80, //  ##   ##
+	0x3B, 0x80, //  ### ###
+	0x3B, 0x80, //  ### ###
+	0x2A, 0x80, //  # # # #
+	0x6E, 0xC0, // ## ### ##
+	0x6E, 0xC0, // ## ### ##
+	0x64, 0xC0, // ##  #  ##
+	0x60, 0xC0, // ##     ##
+	0xFB, 0xE0, //##### #####
+
+	// @142 'a' (8 pixels wide)
+	0xEE, //### ###
+	0x73, // ###  ##
+	0x63, // ##   ##
+	0x7E, // ######
+	0x60, // ##
+	0x60, // ##
+	0x3E, //  #####
+
+	// @149 'c' (8 pixels wide)
+	0x7C, // #####
+	0xC6, //##   ##
+	0x83, //#     ##
+	0x03, //      ##
+	0x83, //#     ##
+	0xC6, //##   ##
+	0xBC, //# ####
+
+	// @156 'd' (9 pixels wide)
+	0xEE, 0x00, //### ###
+	0x73, 0x00, // ###  ##
+	0x61, 0x80, // ##    ##
+	0x61, 0x80, // ##    ##
+	0x61, 0x80, // ##    ##
+	0x73, 0x00, // ###  ##
+	0x6E, 0x00, // ## ###
+	0x60, 0x00, // ##
+	0x60, 0x00, // ##
+	0x70, 0x00, // ###
+
+	// @176 'e' (9 pixels wide)
+	0x7E, 0x00, // ######
+	0xC3, 0x00, //##    ##
+	0x01, 0x80, //       ##
+	0xFF, 0x80, //#########
+	0xC1, 0x80, //##     ##
+	0x63, 0x00, // ##   ##
+	0x3E, 0x00, //  #####
+
+	// @190 'f' (9 pixels wide)
+	0x3F, 0x80, //  #######
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x3F, 0x80, //  #######
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0xFC, 0x00, //######
+
+	// @210 'i' (8 pixels wide)
+	0xFF, //########
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x1E, //   ####
+	0x00, //
+	0x18, //   ##
+	0x18, //   ##
+
+	// @220 'l' (8 pixels wide)
+	0xFF, //########
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x18, //   ##
+	0x1E, //   ####
+
+	// @230 'm' (10 pixels wide)
+	0xED, 0xC0, //### ## ###
+	0x6D, 0x80, // ## ## ##
+	0x6D, 0x80, // ## ## ##
+	0x6D, 0x80, // ## ## ##
+	0x6D, 0x80, // ## ## ##
+	0x6D, 0x80, // ## ## ##
+	0x3F, 0xC0, //  ########
+
+	// @244 'n' (9 pixels wide)
+	0xF7, 0x80, //#### ####
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x67, 0x00, // ##  ###
+	0x3B, 0x80, //  ### ###
+
+	// @258 'o' (9 pixels wide)
+	0x3E, 0x00, //  #####
+	0x63, 0x00, // ##   ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0xC1, 0x80, //##     ##
+	0x63, 0x00, // ##   ##
+	0x3E, 0x00, //  #####
+
+	// @272 'p' (9 pixels wide)
+	0x0F, 0x80, //    #####
+	0x03, 0x00, //      ##
+	0x03, 0x00, //      ##
+	0x3B, 0x00, //  ### ##
+	0x67, 0x00, // ##  ###
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0xC3, 0x00, //##    ##
+	0x67, 0x00, // ##  ###
+	0x3B, 0x80, //  ### ###
+
+	// @292 'r' (9 pixels wide)
+	0x3F, 0x80, //  #######
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0x06, 0x00, //     ##
+	0xCE, 0x00, //##  ###
+	0x77, 0x80, // ### ####
+
+	// @306 't' (8 pixels wide)
+	0x78, // ####
+	0x8C, //#   ##
+	0x0C, //    ##
+	0x0C, //    ##
+	0x0C, //    ##
+	0x0C, //    ##
+	0x7F, // #######
+	0x0C, //    ##
+	0x0C, //    ##
+	0x0C, //    ##
+
+	// @316 'u' (9 pixels wide)
+	0xEE, 0x00, //### ###
+	0x73, 0x00, // ###  ##
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x63, 0x00, // ##   ##
+	0x73, 0x80, // ###  ###
+
+	// @330 'y' (10 pixels wide)
+	0x0F, 0x80, //    #####
+	0x06, 0x00, //     ##
+	0x0C, 0x00, //    ##
+	0x0C, 0x00, //    ##
+	0x1E, 0x00, //   ####
+	0x1A, 0x00, //   ## #
+	0x33, 0x00, //  ##  ##
+	0x33, 0x00, //  ##  ##
+	0x61, 0x80, // ##    ##
+	0xF3, 0xC0, //####  ####
+};
+
+/* offset, left, top, width, height */
+const sGLYPH Font16_Rot180_Glyphs[] PROGMEM =
+{
+	{0, 5, 5, 2, 7}, // ':'
+	{7, 0, 5, 10, 9}, // 'A'
+	{25, 1, 5, 9, 9}, // 'C'
+	{43, 1, 5, 9, 9}, // 'D'
+	{61, 1, 5, 9, 9}, // 'G'
+	{79, 1, 5, 9, 9}, // 'J'
+	{97, 0, 5, 11, 9}, // 'M'
+	{115, 2, 5, 8, 9}, // 'P'
+	{124, 0, 5, 11, 9}, // 'W'
+	{142, 1, 5, 8, 7}, // 'a'
+	{149, 2, 5, 8, 7}, // 'c'
+	{156, 1, 5, 9, 10}, // 'd'
+	{176, 1, 5, 9, 7}, // 'e'
+	{190, 0, 5, 9, 10}, // 'f'
+	{210, 1, 5, 8, 10}, // 'i'
+	{220, 1, 5, 8, 10}, // 'l'
+	{230, 0, 5, 10, 7}, // 'm'
+	{244, 1, 5, 9, 7}, // 'n'
+	{258, 1, 5, 9, 7}, // 'o'
+	{272, 1, 2, 9, 10}, // 'p'
+	{292, 1, 5, 9, 7}, // 'r'
+	{306, 2, 5, 8, 10}, // 't'
+	{316, 1, 5, 9, 7}, // 'u'
+	{330, 0, 2, 10, 10}, // 'y'
+};
+
+/* glyph slot for each char from ' ', 0xFF = not in the font */
+const uint8_t Font16_Rot180_Index[] PROGMEM =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x01, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x05, 0xFF, 0xFF, 0x06, 0xFF, 0xFF,
+	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x09, 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0xFF, 0xFF, 0x0E, 0xFF, 0xFF, 0x0F, 0x10, 0x11, 0x12,
+	0x13, 0xFF, 0x14, 0xFF, 0x15, 0x16, 0xFF, 0xFF, 0xFF, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+sFONT Font16_Rot180 = {
+  Font16_Rot180_Table,
+  11, /* Width */
+  16, /* Height */
+  ROTATE_180, /* Rotate */
+  Font16_Rot180_Index,
+  Font16_Rot180_Glyphs,
+};
+
+/* END OF FILE */
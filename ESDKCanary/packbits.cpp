@@ -0,0 +1,26 @@
+#include <avr/pgmspace.h>
+#include <string.h>
+#include "packbits.h"
+
+namespace {
+
+struct RamSink {
+  unsigned char* dst;
+
+  void copy_P(const unsigned char* src, unsigned int count) {
+    memcpy_P(dst, src, count);
+    dst += count;
+  }
+
+  void fill(unsigned char value, unsigned int count) {
+    memset(dst, value, count);
+    dst += count;
+  }
+};
+
+}
+
+void UnpackBits_P(const unsigned char* src, unsigned char* dst, unsigned int len) {
+  RamSink sink = {dst};
+  PackBitsDecode_P(src, len, sink);
+}
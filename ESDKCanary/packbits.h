@@ -0,0 +1,35 @@
+#ifndef _ESDK_PACKBITS_H_
+#define _ESDK_PACKBITS_H_
+
+#include <avr/pgmspace.h>
+
+// PackBits images in flash, made with tools/imgpack.py. A control byte
+// n in 0..127 is followed by n+1 literal bytes, n in 129..255 by one
+// byte to repeat 257-n times; 128 is skipped.
+
+// Decodes the first len bytes of a packed image into sink, a run at a
+// time: sink.copy_P(src, count) for literals still in flash and
+// sink.fill(value, count) for repeats
+template <typename Sink>
+void PackBitsDecode_P(const unsigned char* src, unsigned int len, Sink& sink) {
+  while (len > 0) {
+    unsigned int n = pgm_read_byte(src++);
+    unsigned int count;
+    if (n < 128) {
+      count = n + 1 < len ? n + 1 : len;
+      sink.copy_P(src, count);
+      src += n + 1;
+    } else if (n > 128) {
+      count = 257 - n < len ? 257 - n : len;
+      sink.fill(pgm_read_byte(src++), count);
+    } else {
+      continue;
+    }
+    len -= count;
+  }
+}
+
+// Decodes the first len bytes of a packed image into dst
+void UnpackBits_P(const unsigned char* src, unsigned char* dst, unsigned int len);
+
+#endif
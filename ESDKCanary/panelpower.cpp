@@ -0,0 +1,33 @@
+#include <string.h>
+#include "panelpower.h"
+
+PanelPower::PanelPower() {
+  config.sleepAfterMs = 20UL * 1000;
+  config.keepRam = true;
+  memset(&counters, 0, sizeof(counters));
+}
+
+// A refresh just finished
+void PanelPower::noteActive(unsigned long now) {
+  _lastActive = now;
+}
+
+bool PanelPower::due(unsigned long now) {
+  return config.sleepAfterMs && now - _lastActive >= config.sleepAfterMs;
+}
+
+void PanelPower::noteSleep(void) {
+  counters.sleeps++;
+}
+
+void PanelPower::noteWake(unsigned long us, bool restored) {
+  counters.wakes++;
+  if (restored) {
+    counters.restores++;
+  }
+  counters.lastWakeUs = us;
+  if (us > counters.maxWakeUs) {
+    counters.maxWakeUs = us;
+  }
+  counters.totalWakeUs += us;
+}
@@ -0,0 +1,36 @@
+#ifndef _ESDK_PANEL_POWER_H_
+#define _ESDK_PANEL_POWER_H_
+
+// Puts the panel into deep sleep once it has been idle for sleepAfterMs
+// after a refresh. Deep sleep mode 1 (keepRam) keeps both RAM planes;
+// mode 2 draws less current but loses them, so the screen has to be
+// rewritten on wake. Wake times are in microseconds.
+struct PanelPowerConfig {
+  unsigned long sleepAfterMs;   // 0 = never sleep
+  bool keepRam;
+};
+
+struct PanelPowerCounters {
+  unsigned long sleeps;
+  unsigned long wakes;
+  unsigned long restores;       // wakes that rewrote the RAM planes
+  unsigned long lastWakeUs;
+  unsigned long maxWakeUs;
+  unsigned long totalWakeUs;
+};
+
+class PanelPower {
+  public:
+  PanelPowerConfig config;
+  PanelPowerCounters counters;
+
+  PanelPower();
+  void noteActive(unsigned long now);
+  bool due(unsigned long now);
+  void noteSleep(void);
+  void noteWake(unsigned long us, bool restored);
+  private:
+  unsigned long _lastActive = 0;
+};
+
+#endif
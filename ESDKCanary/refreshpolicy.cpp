@@ -0,0 +1,48 @@
+#include <string.h>
+#include "refreshpolicy.h"
+
+RefreshPolicy::RefreshPolicy() {
+  // At most 6 full refreshes an hour, one an hour on a steady screen
+  config.maxPartials = 100;
+  config.maxArea = 50UL * 128 * 296;
+  config.maxAgeMs = 60UL * 60 * 1000;
+  config.quietMs = 15UL * 1000;
+  config.minIntervalMs = 10UL * 60 * 1000;
+  memset(&counters, 0, sizeof(counters));
+}
+
+void RefreshPolicy::notePartial(unsigned long now, unsigned long area) {
+  counters.partials++;
+  counters.partialsSinceFull++;
+  counters.areaSinceFull += area;
+  _lastPartial = now;
+}
+
+void RefreshPolicy::noteFull(unsigned long now, bool scheduled) {
+  counters.fulls++;
+  if (scheduled) {
+    counters.scheduledFulls++;
+  }
+  counters.partialsSinceFull = 0;
+  counters.areaSinceFull = 0;
+  _lastFull = now;
+}
+
+// A screen that never goes quiet still gets its full refresh once it
+// is twice maxAgeMs old
+bool RefreshPolicy::due(unsigned long now) {
+  if (counters.partialsSinceFull == 0) {
+    return false; // nothing to clean up
+  }
+  if (config.minIntervalMs && now - _lastFull < config.minIntervalMs) {
+    return false;
+  }
+  unsigned long age = now - _lastFull;
+  bool worn = (config.maxPartials && counters.partialsSinceFull >= config.maxPartials) ||
+              (config.maxArea && counters.areaSinceFull >= config.maxArea) ||
+              (config.maxAgeMs && age >= config.maxAgeMs);
+  if (!worn) {
+    return false;
+  }
+  return now - _lastPartial >= config.quietMs || (config.maxAgeMs && age >= 2 * config.maxAgeMs);
+}
@@ -0,0 +1,40 @@
+#ifndef _ESDK_REFRESH_POLICY_H_
+#define _ESDK_REFRESH_POLICY_H_
+
+// Partial refreshes leave ghosting behind that only a full refresh
+// clears. RefreshPolicy counts the partial refreshes since the last
+// full one and the area they rewrote, and says when a full refresh is
+// due: after maxPartials partials, maxArea pixels or maxAgeMs. It
+// waits until nothing has been drawn for quietMs, and never allows
+// two full refreshes within minIntervalMs. A limit of 0 turns it off.
+struct RefreshPolicyConfig {
+  unsigned int maxPartials;
+  unsigned long maxArea;        // pixels rewritten by partial refreshes
+  unsigned long maxAgeMs;       // since the last full refresh
+  unsigned long quietMs;
+  unsigned long minIntervalMs;
+};
+
+struct RefreshCounters {
+  unsigned long partials;       // since boot
+  unsigned long fulls;
+  unsigned long scheduledFulls; // fulls run because the policy asked
+  unsigned int partialsSinceFull;
+  unsigned long areaSinceFull;
+};
+
+class RefreshPolicy {
+  public:
+  RefreshPolicyConfig config;
+  RefreshCounters counters;
+
+  RefreshPolicy();
+  void notePartial(unsigned long now, unsigned long area);
+  void noteFull(unsigned long now, bool scheduled);
+  bool due(unsigned long now);
+  private:
+  unsigned long _lastFull = 0;
+  unsigned long _lastPartial = 0;
+};
+
+#endif
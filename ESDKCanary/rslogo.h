@@ -26,304 +26,74 @@
 #ifndef _ESDK_RSLOGO_H_
 #define _ESDK_RSLOGO_H_
 
-// 'rslogo-bg', 128x296px
+// 'rslogo-bg', 128x296px, PackBits: 1042 bytes (4736 raw)
 const unsigned char RSLOGO[] PROGMEM = {
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-	0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-	0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff,
-	0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-	0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x03, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x07, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xf8, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-	0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-	0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-	0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-	0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff,
+	0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff,
+	0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff,
+	0x81, 0xff, 0xdf, 0xff, 0x00, 0xfe, 0xf7, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xf8, 0xf7, 0x00,
+	0x00, 0x0f, 0xfd, 0xff, 0x00, 0xf0, 0xf7, 0xff, 0x00, 0x87, 0xfd, 0xff, 0x00, 0xe3, 0xf7, 0xff,
+	0x00, 0xe3, 0xfd, 0xff, 0x00, 0xe3, 0xf7, 0xff, 0x00, 0xf3, 0xfd, 0xff, 0x00, 0xe7, 0xf7, 0xff,
+	0x00, 0xf3, 0xfd, 0xff, 0x00, 0xe7, 0xf7, 0xff, 0x00, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xf0, 0xfc,
+	0x00, 0x04, 0x1f, 0xff, 0xc0, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xe0, 0xfc, 0x00, 0x04, 0x0f,
+	0xff, 0xc0, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x0f, 0xff, 0x80, 0x01,
+	0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff,
+	0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0,
+	0xfc, 0x00, 0x04, 0x07, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04,
+	0x07, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x03, 0xff, 0x80,
+	0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xfd,
+	0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7,
+	0xc0, 0xfc, 0x00, 0x04, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00,
+	0x04, 0x03, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfc, 0x00, 0x04, 0x03, 0xff,
+	0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xc0, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x80,
+	0x01, 0xf3, 0xfd, 0xff, 0x02, 0xe7, 0xc0, 0x00, 0xfe, 0xff, 0x05, 0x00, 0x01, 0xff, 0x80, 0x01,
+	0xf3, 0xfd, 0xff, 0x02, 0xe7, 0xc0, 0x01, 0xfe, 0xff, 0x05, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3,
+	0xfd, 0xff, 0x02, 0xe7, 0xc0, 0x01, 0xfe, 0xff, 0x05, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xfd,
+	0xff, 0x02, 0xe7, 0xc0, 0x01, 0xfe, 0xff, 0x05, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff,
+	0x02, 0xe7, 0xc0, 0x01, 0xfe, 0xff, 0x05, 0xc0, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x02,
+	0xe7, 0xc0, 0x01, 0xfe, 0xff, 0x05, 0xc0, 0x00, 0x7f, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x02, 0xe7,
+	0xc0, 0x01, 0xfe, 0xff, 0x05, 0xc0, 0x00, 0x07, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x02, 0xe7, 0xc0,
+	0x01, 0xfe, 0xff, 0x05, 0xe0, 0x00, 0x03, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x02, 0xe7, 0xc0, 0x00,
+	0xfe, 0xff, 0x05, 0xe0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xc0, 0x00, 0x00,
+	0x01, 0xff, 0xf0, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06,
+	0x7f, 0xff, 0x00, 0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x3f,
+	0xff, 0x80, 0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x1f, 0xff,
+	0x80, 0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0xff, 0x80,
+	0x01, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0xf0, 0x00, 0x01,
+	0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0xe0, 0x00, 0x01, 0x80,
+	0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0xc0, 0x00, 0x01, 0x80, 0x01,
+	0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0xc0, 0x00, 0x03, 0x80, 0x01, 0xf3,
+	0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x06, 0x0f, 0x80, 0x00, 0x07, 0x80, 0x01, 0xf3, 0xfd,
+	0xff, 0x01, 0xe7, 0xe0, 0xfe, 0x00, 0x06, 0x0f, 0x80, 0x00, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff,
+	0x01, 0xe7, 0xf0, 0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01,
+	0xe7, 0xf8, 0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7,
+	0xfe, 0xfe, 0x00, 0x06, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff,
+	0xff, 0xfc, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff,
+	0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe,
+	0x00, 0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00,
+	0x0f, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f,
+	0x80, 0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80,
+	0x01, 0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01,
+	0xff, 0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff,
+	0x80, 0x01, 0xf3, 0xfd, 0xff, 0x0b, 0xe7, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x80, 0x01, 0xff, 0x80,
+	0x01, 0xf3, 0xfd, 0xff, 0x06, 0xe7, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01,
+	0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xe0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3,
+	0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd,
+	0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff,
+	0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01,
+	0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7,
+	0xc0, 0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0,
+	0xfe, 0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe,
+	0x00, 0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00,
+	0x01, 0x0f, 0x80, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01,
+	0x0f, 0xc0, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x0f,
+	0xc0, 0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x1f, 0xe0,
+	0xfe, 0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x01, 0xe7, 0xc0, 0xfe, 0x00, 0x01, 0x3f, 0xf0, 0xfe,
+	0x00, 0x01, 0x01, 0xf3, 0xfd, 0xff, 0x00, 0xe7, 0xf7, 0xff, 0x00, 0xf3, 0xfd, 0xff, 0x00, 0xe7,
+	0xf7, 0xff, 0x00, 0xf3, 0xfd, 0xff, 0x00, 0xe3, 0xf7, 0xff, 0x00, 0xf3, 0xfd, 0xff, 0x00, 0xe3,
+	0xf7, 0xff, 0x00, 0xe3, 0xfd, 0xff, 0x00, 0xf1, 0xf7, 0xff, 0x00, 0xc7, 0xfd, 0xff, 0x00, 0xf8,
+	0xf7, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00, 0xfe, 0xf7, 0x00, 0x00, 0x1f, 0x81, 0xff, 0x81, 0xff,
+	0xbf, 0xff,
 };
 
 #endif
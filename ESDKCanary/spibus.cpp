@@ -0,0 +1,71 @@
+#include <string.h>
+#include "spibus.h"
+
+SpiBus spiBus;
+
+SpiBusClient::SpiBusClient(SPISettings settings, unsigned int maxBurst)
+  : maxBurst(maxBurst), _settings(settings) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+// Every client calls this - only the first one starts the peripheral
+void SpiBus::begin(void) {
+  if (!_begun) {
+    SPI.begin();
+    _begun = true;
+  }
+}
+
+// Nothing to do if the client still holds the bus
+void SpiBus::acquire(SpiBusClient& client) {
+  if (_owner == &client) {
+    return;
+  }
+  if (_owner) {
+    release(*_owner);
+  }
+  SPI.beginTransaction(client._settings);
+  unsigned long now = micros();
+  if (client._waiting) {
+    unsigned long wait = now - client._requestedAt;
+    client.stats.waitUs += wait;
+    if (wait > client.stats.maxWaitUs) {
+      client.stats.maxWaitUs = wait;
+    }
+    client._waiting = false;
+  }
+  client.stats.bursts++;
+  client._acquiredAt = now;
+  _owner = &client;
+}
+
+void SpiBus::release(SpiBusClient& client) {
+  if (_owner != &client) {
+    return;
+  }
+  unsigned long hold = micros() - client._acquiredAt;
+  client.stats.holdUs += hold;
+  if (hold > client.stats.maxHoldUs) {
+    client.stats.maxHoldUs = hold;
+  }
+  _owner = NULL;
+  SPI.endTransaction();
+}
+
+// The client wants the bus - its wait runs until the next acquire()
+void SpiBus::request(SpiBusClient& client) {
+  if (!client._waiting) {
+    client._waiting = true;
+    client._requestedAt = micros();
+  }
+}
+
+// Called by a client between chunks of a long burst, after release():
+// the bus is free for others until the client acquires it again
+void SpiBus::handOver(SpiBusClient& client) {
+  request(client);
+}
+
+SpiBusClient* SpiBus::owner(void) {
+  return _owner;
+}
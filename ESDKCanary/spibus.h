@@ -0,0 +1,51 @@
+#ifndef _ESDK_SPI_BUS_H_
+#define _ESDK_SPI_BUS_H_
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// Clients of one SPI peripheral. Each holds the bus inside its own
+// transaction at its own clock, and gives it up between chunks of a
+// long burst so another client - an SD card, say - can get in. On the
+// Nano 33 IoT the panel has SPI to itself: WiFiNINA talks to the
+// NINA-W102 over SPIWIFI, a separate SERCOM. Times are in microseconds.
+struct SpiBusStats {
+  unsigned long bursts;
+  unsigned long holdUs;         // total time holding the bus
+  unsigned long maxHoldUs;
+  unsigned long waitUs;         // total time between request() and acquire()
+  unsigned long maxWaitUs;
+};
+
+class SpiBusClient {
+  public:
+  SpiBusStats stats;
+  unsigned int maxBurst;        // bytes before handing the bus back, 0 = no limit
+
+  SpiBusClient(SPISettings settings, unsigned int maxBurst);
+  private:
+  friend class SpiBus;
+  SPISettings _settings;
+  bool _waiting = false;
+  unsigned long _requestedAt = 0;
+  unsigned long _acquiredAt = 0;
+};
+
+// A client may keep the bus between its own transfers, with CS high;
+// acquire() by anyone else releases it first
+class SpiBus {
+  public:
+  void begin(void);
+  void acquire(SpiBusClient& client);
+  void release(SpiBusClient& client);
+  void request(SpiBusClient& client);
+  void handOver(SpiBusClient& client);
+  SpiBusClient* owner(void);
+  private:
+  bool _begun = false;
+  SpiBusClient* _owner = NULL;
+};
+
+extern SpiBus spiBus;
+
+#endif
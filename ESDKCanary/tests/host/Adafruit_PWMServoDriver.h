@@ -0,0 +1,14 @@
+#ifndef HOST_PWM_SERVO_DRIVER_H
+#define HOST_PWM_SERVO_DRIVER_H
+
+#include <Arduino.h>
+
+// Writes are recorded by emu.cpp
+struct Adafruit_PWMServoDriver {
+  void begin(void) {}
+  void setOscillatorFrequency(uint32_t) {}
+  void setPWMFreq(float) {}
+  void setPWM(uint8_t num, uint16_t on, uint16_t off);
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef HOST_SOUNDBOARD_H
+#define HOST_SOUNDBOARD_H
+
+#include <Arduino.h>
+
+struct Adafruit_Soundboard {
+  bool reset(void) { return true; }
+  bool playTrack(uint8_t) { return true; }
+};
+
+#endif
@@ -0,0 +1,57 @@
+// Arduino core for the host tests - just what the library uses. Time,
+// pins and SPI are modelled in emu.cpp.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+// Flash and RAM share one address space on the host
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define memcpy_P memcpy
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+int digitalRead(int pin);
+
+void noInterrupts(void);
+void interrupts(void);
+
+struct HostSerial {
+  void begin(long) {}
+  void print(const char*) {}
+  void print(long) {}
+  void println(const char*) {}
+  void println(long) {}
+  operator bool() { return true; }
+};
+extern HostSerial Serial;
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+struct SPISettings {
+  SPISettings() : clock(4000000) {}
+  SPISettings(uint32_t clock, int, int) : clock(clock) {}
+  uint32_t clock;
+};
+
+struct SPIClass {
+  void begin(void);
+  void beginTransaction(SPISettings settings);
+  void endTransaction(void);
+  uint8_t transfer(uint8_t data);
+  void transfer(void* buf, size_t count);
+};
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,276 @@
+#include <stdio.h>
+#include <SPI.h>
+#include <Adafruit_PWMServoDriver.h>
+#include "epdif.h"
+#include "emu.h"
+
+HostSerial Serial;
+SPIClass SPI;
+
+EmuCosts emu_costs = {1.6, 0.5, 1.0, 1.0, 12000000, 2000, 300, 1, 10};
+EmuCounters emu;
+EmuHooks emu_hooks;
+
+static double now_us = 0;
+static int pins[64];
+
+// SSD1680 state
+static uint8_t ram[2][EMU_PANEL_ROWS][EMU_PANEL_BYTES];
+static double busy_until = 0;
+static uint32_t clock_hz = 4000000;
+static int command = -1;
+static int arg = 0;
+static uint8_t args[4];
+static int x_start, x_end, y_start, y_end, x_ptr, y_ptr;
+static uint8_t update_mode = 0;
+static int sleep_mode = 0;      // 0 awake, else the 0x10 data
+
+double emu_now_us(void) {
+  return now_us;
+}
+
+void emu_advance_us(double us) {
+  now_us += us;
+}
+
+bool emu_busy(void) {
+  return now_us < busy_until;
+}
+
+uint8_t emu_last_update_mode(void) {
+  return update_mode;
+}
+
+unsigned long emu_errors(void) {
+  return emu.csErrors + emu.busyViolations + emu.outOfBounds + emu.asleepWrites;
+}
+
+uint8_t emu_ram(int plane, int row, int col) {
+  return ram[plane][row][col];
+}
+
+unsigned long emu_hash(int plane) {
+  unsigned long h = 2166136261UL;
+  for (int y = 0; y < EMU_PANEL_ROWS; y++) {
+    for (int x = 0; x < EMU_PANEL_BYTES; x++) {
+      h = (h ^ ram[plane][y][x]) * 16777619UL;
+    }
+  }
+  return h & 0xFFFFFFFFUL;
+}
+
+// Writes a plane as a P4 bitmap, bit set = white as on the panel
+bool emu_write_pbm(int plane, const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    return false;
+  }
+  fprintf(f, "P4\n%d %d\n", EMU_PANEL_BYTES * 8, EMU_PANEL_ROWS);
+  for (int y = 0; y < EMU_PANEL_ROWS; y++) {
+    for (int x = 0; x < EMU_PANEL_BYTES; x++) {
+      fputc(~ram[plane][y][x] & 0xFF, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+unsigned long millis(void) {
+  return (unsigned long)(now_us / 1000);
+}
+
+unsigned long micros(void) {
+  now_us += emu_costs.microsUs;
+  return (unsigned long)now_us;
+}
+
+void delay(unsigned long ms) {
+  now_us += ms * 1000.0;
+}
+
+void delayMicroseconds(unsigned int us) {
+  now_us += us;
+}
+
+void yield(void) {
+  now_us += 1;
+  emu.yields++;
+}
+
+void noInterrupts(void) {
+}
+
+void interrupts(void) {
+}
+
+void pinMode(int, int) {
+}
+
+// A reset pulse wakes the panel; the RAM planes are lost if it was in
+// deep sleep mode 2
+void digitalWrite(int pin, int value) {
+  now_us += emu_costs.pinCallUs;
+  emu.pinCalls++;
+  if (pin == RST_PIN && value == LOW && pins[pin] != LOW) {
+    emu.resets++;
+    busy_until = now_us;
+    if (sleep_mode == 0x03) {
+      memset(ram, 0x55, sizeof(ram));
+    }
+    sleep_mode = 0;
+    if (emu_hooks.reset) {
+      emu_hooks.reset();
+    }
+  }
+  pins[pin] = value;
+}
+
+int digitalRead(int pin) {
+  now_us += emu_costs.pinCallUs;
+  emu.pinCalls++;
+  if (pin == BUSY_PIN) {
+    return emu_busy() ? HIGH : LOW;
+  }
+  return pins[pin];
+}
+
+void Adafruit_PWMServoDriver::setPWM(uint8_t, uint16_t, uint16_t off) {
+  emu.pwmWrites++;
+  emu.pwmLast = off;
+  if (emu_hooks.pwm) {
+    emu_hooks.pwm(off);
+  }
+}
+
+static void start_busy(double ms) {
+  busy_until = now_us + ms * 1000;
+}
+
+static void panel_command(uint8_t c) {
+  emu.commands++;
+  command = c;
+  arg = 0;
+  if (emu_hooks.command) {
+    emu_hooks.command(c);
+  }
+  if (c == 0x12) {
+    start_busy(emu_costs.swResetMs);
+  } else if (c == 0x20) {
+    if (update_mode == 0xC0) {
+      start_busy(emu_costs.clockOnMs);
+    } else if (update_mode == 0x0F || update_mode == 0xFF) {
+      emu.partials++;
+      start_busy(emu_costs.partialMs);
+    } else {
+      emu.fulls++;
+      start_busy(emu_costs.fullMs);
+    }
+  }
+}
+
+static void panel_data(uint8_t d) {
+  if (emu_hooks.data) {
+    emu_hooks.data(d);
+  }
+  if (command == 0x24 || command == 0x26) {
+    if (y_ptr < 0 || y_ptr >= EMU_PANEL_ROWS || x_ptr < 0 || x_ptr >= EMU_PANEL_BYTES) {
+      emu.outOfBounds++;
+    } else {
+      ram[command == 0x26][y_ptr][x_ptr] = d;
+    }
+    emu.ramBytes++;
+    // The address counter runs across the window and wraps inside it
+    if (++x_ptr > x_end) {
+      x_ptr = x_start;
+      if (++y_ptr > y_end) {
+        y_ptr = y_start;
+      }
+    }
+    return;
+  }
+  if (arg < 4) {
+    args[arg] = d;
+  }
+  arg++;
+  switch (command) {
+    case 0x10:
+      if (d) {
+        sleep_mode = d;
+        emu.sleeps++;
+      }
+      break;
+    case 0x22:
+      update_mode = d;
+      break;
+    case 0x32:
+      if (arg == 153) {
+        emu.lutLoads++;
+      }
+      break;
+    case 0x44:
+      if (arg == 2) {
+        x_start = args[0];
+        x_end = args[1];
+      }
+      break;
+    case 0x45:
+      if (arg == 4) {
+        y_start = args[0] | args[1] << 8;
+        y_end = args[2] | args[3] << 8;
+      }
+      break;
+    case 0x4E:
+      x_ptr = args[0];
+      break;
+    case 0x4F:
+      if (arg == 2) {
+        y_ptr = args[0] | args[1] << 8;
+      }
+      break;
+  }
+}
+
+void SPIClass::begin(void) {
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+  clock_hz = settings.clock < emu_costs.spiMaxClock ? settings.clock : emu_costs.spiMaxClock;
+  now_us += emu_costs.transactionUs;
+  emu.transactions++;
+}
+
+void SPIClass::endTransaction(void) {
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  now_us += 8e6 / clock_hz + emu_costs.spiCallUs;
+  emu.spiBytes++;
+  if (pins[CS_PIN] != LOW) {
+    emu.csErrors++;
+  }
+  if (emu_busy()) {
+    emu.busyViolations++;
+  }
+  if (sleep_mode) {
+    emu.asleepWrites++;
+    return 0;
+  }
+  if (pins[DC_PIN] == LOW) {
+    panel_command(data);
+  } else {
+    panel_data(data);
+  }
+  return 0;
+}
+
+// Stands in for a DMA transfer: the bytes reach the panel, but the CPU
+// time is the caller's to model
+void SPIClass::transfer(void* buf, size_t count) {
+  double start = now_us;
+  uint8_t* p = (uint8_t*)buf;
+  for (size_t i = 0; i < count; i++) {
+    p[i] = transfer(p[i]);
+  }
+  now_us = start;
+  emu.dmaBytes += count;
+}
@@ -0,0 +1,74 @@
+// Host model of the board and the panel for the tests.
+//
+// Time only moves when the code under test spends it: each pin call
+// and SPI byte has a cost, delay() and yield() advance the clock, and
+// tests call emu_advance_us() for work done elsewhere in loop(). The
+// SSD1680 model decodes the command stream into its two RAM planes,
+// drives BUSY after SWRESET and master activation, and counts
+// protocol errors the tests expect to stay at zero.
+#ifndef HOST_EMU_H
+#define HOST_EMU_H
+
+#include <Arduino.h>
+
+#define EMU_PANEL_ROWS  296
+#define EMU_PANEL_BYTES 16      // per row
+
+struct EmuCosts {
+  double pinCallUs;             // digitalWrite()/digitalRead() on a SAMD21
+  double spiCallUs;             // SPI.transfer(byte) call overhead
+  double transactionUs;         // SPI.beginTransaction() plus endTransaction()
+  double microsUs;              // a micros() read
+  uint32_t spiMaxClock;         // the SAMD21 core caps SPI at 12 MHz
+  double fullMs;                // BUSY after master activation, by 0x22 mode
+  double partialMs;
+  double clockOnMs;             // 0x22 0xC0, clock and analog on
+  double swResetMs;             // BUSY after SWRESET (0x12)
+};
+
+struct EmuCounters {
+  unsigned long pinCalls;
+  unsigned long spiBytes;       // every byte on the wire
+  unsigned long dmaBytes;       // of those, sent with SPI.transfer(buf, n)
+  unsigned long transactions;
+  unsigned long commands;
+  unsigned long ramBytes;       // written to either RAM plane
+  unsigned long lutLoads;
+  unsigned long resets;         // hardware reset pulses
+  unsigned long fulls;          // display updates by kind
+  unsigned long partials;
+  unsigned long sleeps;
+  unsigned long yields;
+  unsigned long pwmWrites;
+  uint16_t pwmLast;
+  // Protocol errors
+  unsigned long csErrors;       // byte sent with CS high
+  unsigned long busyViolations; // byte sent while BUSY is high
+  unsigned long outOfBounds;    // RAM write outside the panel
+  unsigned long asleepWrites;   // byte sent to a panel in deep sleep
+};
+
+// Optional taps on the panel's command stream and the servo
+struct EmuHooks {
+  void (*reset)(void);
+  void (*command)(uint8_t command);
+  void (*data)(uint8_t data);
+  void (*pwm)(uint16_t value);
+};
+
+extern EmuCosts emu_costs;
+extern EmuCounters emu;
+extern EmuHooks emu_hooks;
+
+double emu_now_us(void);
+void emu_advance_us(double us);
+bool emu_busy(void);
+uint8_t emu_last_update_mode(void);   // data of the last 0x22
+unsigned long emu_errors(void);       // sum of the protocol errors
+
+// Panel RAM, plane 0 is 0x24 and plane 1 is 0x26
+uint8_t emu_ram(int plane, int row, int col);
+unsigned long emu_hash(int plane);
+bool emu_write_pbm(int plane, const char* path);
+
+#endif
@@ -0,0 +1,60 @@
+// Checks and timing for the host tests. CHECK() reports and counts a
+// failure, test_result() turns the count into the exit status.
+#ifndef HOST_TESTING_H
+#define HOST_TESTING_H
+
+#include <stdio.h>
+#include <time.h>
+
+static int test_failures = 0;
+
+#define CHECK(cond) \
+  test_check((cond), #cond, __FILE__, __LINE__)
+
+#define CHECK_EQ(a, b) \
+  test_check_eq((long)(a), (long)(b), #a " == " #b, __FILE__, __LINE__)
+
+static inline bool test_check(bool ok, const char* what, const char* file, int line) {
+  if (!ok) {
+    printf("%s:%d: FAILED %s\n", file, line, what);
+    test_failures++;
+  }
+  return ok;
+}
+
+static inline bool test_check_eq(long a, long b, const char* what, const char* file, int line) {
+  if (a != b) {
+    printf("%s:%d: FAILED %s (%ld != %ld)\n", file, line, what, a, b);
+    test_failures++;
+  }
+  return a == b;
+}
+
+static inline int test_result(const char* name) {
+  if (test_failures) {
+    printf("%s: %d failed\n", name, test_failures);
+    return 1;
+  }
+  printf("%s: ok\n", name);
+  return 0;
+}
+
+// Wall time for the throughput benchmarks, in seconds
+static inline double bench_seconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Deterministic random numbers in [0, n) for the differential tests
+static unsigned long test_seed = 12345;
+
+static inline int test_rand(int n) {
+  test_seed = test_seed * 1103515245UL + 12345UL;
+  return (int)((test_seed >> 16) & 0x7FFF) % n;
+}
+
+// Keeps a benchmark's result alive without the optimiser removing it
+static volatile unsigned long bench_sink;
+
+#endif
@@ -0,0 +1,96 @@
+// The sketch's loop() keeps servicing MQTT while the panel refreshes:
+// every display call returns without waiting for BUSY, and the
+// tombstone's settling pause is a state rather than a delay().
+#include <stdio.h>
+#include "CanaryDisplay.h"
+#include "emu.h"
+#include "testing.h"
+
+#define LOOP_US 1000    // the rest of loop(), sensors and servo
+#define MAX_GAP_MS 100
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+static ESDKCanary canary(&sfx, &pwm, 0);
+static CanaryDisplay display(&canary);
+
+static unsigned long mqttCalls = 0;
+static unsigned long lastMqttUs = 0;
+static unsigned long maxGapUs = 0;
+
+// Stands in for mqttClient.loop()
+static void mqtt_loop(void) {
+  unsigned long now = micros();
+  if (mqttCalls && now - lastMqttUs > maxGapUs) {
+    maxGapUs = now - lastMqttUs;
+  }
+  lastMqttUs = now;
+  mqttCalls++;
+}
+
+static void loop_once(void) {
+  display.pollDisplay();
+  mqtt_loop();
+  emu_advance_us(LOOP_US);
+}
+
+// Runs loop() from the update until the display is idle again
+static unsigned long run_update(const char* name, int co2) {
+  canary.co2 = co2;
+  mqttCalls = 0;
+  maxGapUs = 0;
+  mqtt_loop();
+  unsigned long start = millis();
+  display.updateDisplay();
+  CHECK(display.isBusy());
+  while (display.isBusy() && millis() - start < 60000) {
+    loop_once();
+  }
+  unsigned long ms = millis() - start;
+  printf("%-10s %5lu ms busy, %5lu MQTT calls, longest gap %.1f ms\n",
+         name, ms, mqttCalls, maxGapUs / 1000.0);
+  CHECK(!display.isBusy());
+  CHECK(maxGapUs < MAX_GAP_MS * 1000UL);
+  CHECK(mqttCalls >= ms * 1000 / (LOOP_US * 2));
+  return ms;
+}
+
+int main(void) {
+  emu_costs.fullMs = 2000;
+  emu_costs.partialMs = 300;
+  display.panelPower.config.sleepAfterMs = 0;
+
+  display.initDisplay();
+  while (display.isBusy()) {
+    loop_once();
+  }
+  display.refreshPolicy.config.quietMs = 0;
+  display.refreshPolicy.config.minIntervalMs = 0;
+
+  run_update("readings", 800);
+  run_update("partial", 1200);
+
+  // A scheduled full refresh to clear ghosting, run from pollDisplay()
+  display.refreshPolicy.config.maxPartials = 1;
+  unsigned long fulls = emu.fulls;
+  unsigned long start = millis();
+  mqttCalls = 0;
+  maxGapUs = 0;
+  do {
+    loop_once();
+  } while ((emu.fulls == fulls || display.isBusy()) && millis() - start < 60000);
+  printf("%-10s %5lu ms busy, %5lu MQTT calls, longest gap %.1f ms\n",
+         "clean", millis() - start, mqttCalls, maxGapUs / 1000.0);
+  CHECK_EQ(emu.fulls, fulls + 1);
+  CHECK(millis() - start >= 2000);
+  CHECK(maxGapUs < MAX_GAP_MS * 1000UL);
+  display.refreshPolicy.config.maxPartials = 100;
+
+  unsigned long ms = run_update("tombstone", DEAD_CO2);
+  CHECK(ms >= TOMBSTONE_SETTLE_MS + 2000);
+  CHECK_EQ(display.currentScene(), SCENE_TOMBSTONE);
+  CHECK_EQ(emu.fulls, fulls + 2);
+
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_async_refresh");
+}
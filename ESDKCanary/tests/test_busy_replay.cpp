@@ -0,0 +1,214 @@
+// Time blocked on BUSY. The driver's command stream is recorded through
+// the panel model's hooks and replayed against the BUSY model: once
+// with the waits the Waveshare driver made, and once waiting only
+// before the first command after a reset, SWRESET (0x12) or master
+// activation (0x20). Both send the same bytes, so the difference in
+// time is the waiting saved, and neither may send a byte while BUSY is
+// high. A third replay that never waits shows the model would notice.
+#include <stdio.h>
+#include <string.h>
+#include <SPI.h>
+#include "epd2in9_V2.h"
+#include "emu.h"
+#include "testing.h"
+
+#define FRAME_BYTES (EPD_WIDTH / 8 * EPD_HEIGHT)
+#define MAX_EVENTS 40000
+#define WINDOWS 11              // readings on the screen, one window each
+#define WINDOW_HEIGHT 24
+
+enum { EV_RESET, EV_COMMAND, EV_DATA };
+
+struct Event {
+  uint8_t kind;
+  uint8_t value;
+  uint8_t phase;
+};
+
+enum { PH_INIT, PH_FULL, PH_PARTIAL, PH_UPDATE, PH_SLEEP, PH_WAKE, PHASES };
+
+static const char* phase_names[PHASES] = {
+  "init", "full", "partial", "update", "sleep", "wake"
+};
+
+static Event events[MAX_EVENTS];
+static int event_count = 0;
+static int phase = 0;
+static unsigned char frame[FRAME_BYTES];
+static unsigned char window[EPD_WIDTH / 8 * WINDOW_HEIGHT];
+
+static void record(uint8_t kind, uint8_t value) {
+  if (event_count < MAX_EVENTS) {
+    events[event_count].kind = kind;
+    events[event_count].value = value;
+    events[event_count].phase = phase;
+  }
+  event_count++;
+}
+
+static void on_reset(void) {
+  record(EV_RESET, 0);
+}
+
+static void on_command(uint8_t c) {
+  record(EV_COMMAND, c);
+}
+
+static void on_data(uint8_t d) {
+  record(EV_DATA, d);
+}
+
+static void send_windows(Epd& epd, int seed) {
+  for (int i = 0; i < WINDOWS; i++) {
+    for (unsigned int j = 0; j < sizeof(window); j++) {
+      window[j] = (j * 13 + i + seed) ^ (j >> 3);
+    }
+    epd.SetFrameMemory_Partial(window, 0, i * (WINDOW_HEIGHT + 2), EPD_WIDTH, WINDOW_HEIGHT);
+  }
+}
+
+static void record_driver(void) {
+  for (int i = 0; i < FRAME_BYTES; i++) {
+    frame[i] = (i * 37) ^ (i >> 4);
+  }
+  emu_hooks.reset = on_reset;
+  emu_hooks.command = on_command;
+  emu_hooks.data = on_data;
+
+  Epd epd;
+  phase = PH_INIT;
+  epd.Init();
+  phase = PH_FULL;
+  epd.SetFrameMemory_Base(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+  epd.DisplayFrame();
+  phase = PH_PARTIAL;
+  epd.BeginPartial();
+  send_windows(epd, 0);
+  epd.DisplayFrame_Partial();
+  phase = PH_UPDATE;
+  send_windows(epd, 1);
+  epd.DisplayFrame_Partial();
+  phase = PH_SLEEP;
+  epd.Sleep(true);
+  epd.EndPartial();
+  phase = PH_WAKE;
+  epd.BeginPartial();
+  send_windows(epd, 2);
+  epd.DisplayFrame_Partial();
+
+  memset(&emu_hooks, 0, sizeof(emu_hooks));
+}
+
+enum { POLICY_NONE, POLICY_WAVESHARE, POLICY_PENDING };
+
+// Epd::WaitUntilIdle(), with the Waveshare driver's trailing delay
+static void wait_idle(bool trailing) {
+  while (digitalRead(BUSY_PIN) == HIGH) {
+    delay(5);
+  }
+  if (trailing) {
+    delay(5);
+  }
+}
+
+// Where the Waveshare driver called WaitUntilIdle(): before SWRESET in
+// Init(), and after SWRESET, SetMemoryPointer(), a LUT load and every
+// master activation. Init() also waited a second time after its
+// pointer; that one is not counted.
+static bool waveshare_waits_before(int i) {
+  const Event& e = events[i];
+  if (e.kind == EV_COMMAND && e.value == 0x12) {
+    return true;
+  }
+  if (e.kind != EV_COMMAND) {
+    return false;
+  }
+  // Find the command the bytes before this one belong to
+  int args = 0;
+  int j = i - 1;
+  while (j >= 0 && events[j].kind == EV_DATA) {
+    args++;
+    j--;
+  }
+  if (j < 0 || events[j].kind != EV_COMMAND) {
+    return false;
+  }
+  switch (events[j].value) {
+    case 0x12:
+    case 0x20:
+      return args == 0;
+    case 0x4F:
+      return args == 2;
+    case 0x32:
+      return args == 153;
+  }
+  return false;
+}
+
+static void send(const Event& e) {
+  if (e.kind == EV_RESET) {
+    digitalWrite(RST_PIN, LOW);
+    digitalWrite(RST_PIN, HIGH);
+    return;
+  }
+  digitalWrite(DC_PIN, e.kind == EV_COMMAND ? LOW : HIGH);
+  digitalWrite(CS_PIN, LOW);
+  SPI.transfer(e.value);
+  digitalWrite(CS_PIN, HIGH);
+}
+
+// Replays the stream and fills in the time spent on each phase. Every
+// phase ends idle, so its waits are not carried into the next.
+static unsigned long replay(int policy, double* phase_us) {
+  unsigned long violations = emu.busyViolations;
+  bool pending = false;
+  int last = 0;
+  double start = emu_now_us();
+  for (int i = 0; i < event_count; i++) {
+    const Event& e = events[i];
+    if (e.phase != last) {
+      wait_idle(false);
+      phase_us[last] = emu_now_us() - start;
+      start = emu_now_us();
+      last = e.phase;
+    }
+    if (policy == POLICY_WAVESHARE && waveshare_waits_before(i)) {
+      wait_idle(true);
+    }
+    if (policy == POLICY_PENDING && e.kind == EV_COMMAND && pending) {
+      wait_idle(false);
+      pending = false;
+    }
+    send(e);
+    if (e.kind == EV_RESET || (e.kind == EV_COMMAND && (e.value == 0x12 || e.value == 0x20))) {
+      pending = true;
+    }
+  }
+  wait_idle(false);
+  phase_us[last] = emu_now_us() - start;
+  return emu.busyViolations - violations;
+}
+
+int main(void) {
+  record_driver();
+  CHECK(event_count <= MAX_EVENTS);
+  CHECK_EQ(emu_errors(), 0);
+
+  double none[PHASES], waveshare[PHASES], pending[PHASES];
+  // Without waiting at all the model must catch bytes sent while busy
+  CHECK(replay(POLICY_NONE, none) > 0);
+  CHECK_EQ(replay(POLICY_WAVESHARE, waveshare), 0);
+  CHECK_EQ(replay(POLICY_PENDING, pending), 0);
+
+  double saved = 0;
+  for (int p = 0; p < PHASES; p++) {
+    printf("%-8s %7.1f -> %7.1f ms, %5.1f ms saved\n", phase_names[p],
+           waveshare[p] / 1000, pending[p] / 1000, (waveshare[p] - pending[p]) / 1000);
+    CHECK(pending[p] <= waveshare[p]);
+    saved += waveshare[p] - pending[p];
+  }
+  printf("total    %5.1f ms saved\n", saved / 1000);
+  // A pointer wait per window and a trailing delay per wait, at least
+  CHECK(pending[PH_UPDATE] + WINDOWS * 5000 < waveshare[PH_UPDATE]);
+  return test_result("test_busy_replay");
+}
@@ -0,0 +1,90 @@
+// Panel traffic per readings update for each library configuration.
+// Whatever the build draws with, the panel RAM after each step must
+// match the same golden hashes. Run with -u to print new ones.
+#include <stdio.h>
+#include <string.h>
+#include "CanaryDisplay.h"
+#include "emu.h"
+#include "testing.h"
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+static ESDKCanary canary(&sfx, &pwm, 0);
+static CanaryDisplay display(&canary);
+
+struct Step {
+  const char* name;
+  int co2;
+  double temperature;
+  double humidity;
+  int tvoc;
+  int pm;
+  DisplayLayouts layout;
+  unsigned long hash[2];      // panel RAM planes afterwards
+};
+
+static Step steps[] = {
+  {"first", 612, 21.4, 40.2, 120, 3, LAYOUT_READINGS, {0x0842c775, 0xc04532f8}},
+  {"co2", 655, 21.4, 40.2, 120, 3, LAYOUT_READINGS, {0x70cbc379, 0xc04532f8}},
+  {"all", 1034, 22.8, 47.9, 310, 11, LAYOUT_READINGS, {0x69f99262, 0xc04532f8}},
+  {"same", 1034, 22.8, 47.9, 310, 11, LAYOUT_READINGS, {0x69f99262, 0xc04532f8}},
+  {"large", 1034, 22.8, 47.9, 310, 11, LAYOUT_LARGE_CO2, {0x85a3a51b, 0x121aac81}},
+  {"large co2", 2456, 22.9, 47.9, 310, 11, LAYOUT_LARGE_CO2, {0x61550223, 0x121aac81}},
+  {"back", 2456, 22.9, 47.9, 310, 11, LAYOUT_READINGS, {0x9bf4621f, 0x3e4b34f4}},
+};
+
+#define STEP_COUNT (int)(sizeof(steps) / sizeof(steps[0]))
+
+// Idle, with the last RAM upload through as well
+static void wait_idle(void) {
+  while (display.isBusy()) {
+    display.pollDisplay();
+    emu_advance_us(1000);
+  }
+  display._epd.WaitTransfer();
+}
+
+int main(int argc, char** argv) {
+  bool update = argc > 1 && strcmp(argv[1], "-u") == 0;
+  display.panelPower.config.sleepAfterMs = 0;
+  display.refreshPolicy.config.maxPartials = 1000;
+  display.refreshPolicy.config.maxArea = 0xFFFFFFFFUL;
+  display.refreshPolicy.config.maxAgeMs = 0xFFFFFFFFUL;
+
+  display.initDisplay();
+  wait_idle();
+
+  printf("CANARY_FRAMEBUFFER=%d CANARY_STREAMING=%d\n", CANARY_FRAMEBUFFER, CANARY_STREAMING);
+  printf("%-10s %6s %6s %8s %6s %6s\n", "step", "bytes", "cmds", "ram", "wins", "ms");
+  for (int i = 0; i < STEP_COUNT; i++) {
+    Step& s = steps[i];
+    canary.co2 = s.co2;
+    canary.temperature = s.temperature;
+    canary.humidity = s.humidity;
+    canary.tvoc = s.tvoc;
+    canary.pm = s.pm;
+    display.setLayout(s.layout);
+    EmuCounters before = emu;
+    double start = emu_now_us();
+    display.updateDisplay();
+    double drawUs = emu_now_us() - start;
+    wait_idle();
+    printf("%-10s %6lu %6lu %8lu %6u %6.1f\n", s.name,
+           emu.spiBytes - before.spiBytes, emu.commands - before.commands,
+           emu.ramBytes - before.ramBytes, display.stats.windows, drawUs / 1000);
+    // One partial session for all the updates, opened by the first
+    if (i > 0) {
+      CHECK_EQ(emu.resets - before.resets, 0);
+      CHECK_EQ(emu.lutLoads - before.lutLoads, 0);
+    }
+    unsigned long hash[2] = {emu_hash(0), emu_hash(1)};
+    if (update) {
+      printf("  {0x%08lx, 0x%08lx}\n", hash[0], hash[1]);
+    } else {
+      CHECK_EQ(hash[0], s.hash[0]);
+      CHECK_EQ(hash[1], s.hash[1]);
+    }
+  }
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_compositor");
+}
@@ -0,0 +1,161 @@
+// Trimmed fonts store each glyph's bounding box only. Each plain font
+// is trimmed here the way tools/fontgen.py does it, and every glyph
+// must draw the same from both, in every rotation. The display subsets
+// in fonts_rot180.cpp must draw their characters like the plain fonts.
+// Reports the table sizes and glyphs per second for both.
+#include <stdio.h>
+#include <string.h>
+#include "epdpaint.h"
+#include "testing.h"
+
+#define W 120
+#define H 40
+#define BUF_BYTES (W / 8 * H)
+#define GLYPHS 95
+
+static sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (int)(sizeof(fonts) / sizeof(fonts[0]))
+
+static unsigned char plain_image[BUF_BYTES];
+static unsigned char trim_image[BUF_BYTES];
+
+struct Trimmed {
+  sFONT font;
+  uint8_t table[GLYPHS * 24 * 3];
+  sGLYPH glyphs[GLYPHS];
+  unsigned int tableBytes;
+};
+
+static bool pixel(const sFONT* font, int slot, int row, int col) {
+  int row_bytes = (font->Width + 7) / 8;
+  const uint8_t* p = &font->table[(slot * font->Height + row) * row_bytes];
+  return p[col / 8] & (0x80 >> (col % 8));
+}
+
+static void trim(const sFONT* plain, Trimmed* t) {
+  unsigned int offset = 0;
+  for (int slot = 0; slot < GLYPHS; slot++) {
+    int left = plain->Width, right = -1, top = plain->Height, bottom = -1;
+    for (int r = 0; r < plain->Height; r++) {
+      for (int c = 0; c < plain->Width; c++) {
+        if (pixel(plain, slot, r, c)) {
+          left = c < left ? c : left;
+          right = c > right ? c : right;
+          top = r < top ? r : top;
+          bottom = r > bottom ? r : bottom;
+        }
+      }
+    }
+    sGLYPH& g = t->glyphs[slot];
+    memset(&g, 0, sizeof(g));
+    g.offset = offset;
+    if (right < 0) {
+      continue;
+    }
+    g.left = left;
+    g.top = top;
+    g.width = right - left + 1;
+    g.height = bottom - top + 1;
+    int bytes = (g.width + 7) / 8;
+    for (int r = top; r <= bottom; r++) {
+      memset(&t->table[offset], 0, bytes);
+      for (int c = left; c <= right; c++) {
+        if (pixel(plain, slot, r, c)) {
+          t->table[offset + (c - left) / 8] |= 0x80 >> ((c - left) % 8);
+        }
+      }
+      offset += bytes;
+    }
+  }
+  t->tableBytes = offset;
+  t->font = *plain;
+  t->font.table = t->table;
+  t->font.glyphs = t->glyphs;
+}
+
+// Draws c at random spots, clipped too, from both fonts in each rotation
+static int compare(sFONT* plain, sFONT* other, char c) {
+  int mismatches = 0;
+  for (int rotate = ROTATE_0; rotate <= ROTATE_270; rotate++) {
+    for (int run = 0; run < 4; run++) {
+      int x = test_rand(W + plain->Width) - plain->Width / 2;
+      int y = test_rand(W + plain->Height) - plain->Height / 2;
+      int colored = test_rand(2);
+      for (int i = 0; i < BUF_BYTES; i++) {
+        plain_image[i] = trim_image[i] = test_rand(256);
+      }
+      Paint a(plain_image, W, H);
+      Paint b(trim_image, W, H);
+      a.SetRotate(rotate);
+      b.SetRotate(rotate);
+      a.DrawCharAt(x, y, c, plain, colored);
+      b.DrawCharAt(x, y, c, other, colored);
+      if (memcmp(plain_image, trim_image, BUF_BYTES) != 0 && mismatches++ < 3) {
+        printf("mismatch: font %dx%d '%c' rotate %d at %d,%d\n",
+               plain->Width, plain->Height, c, rotate, x, y);
+      }
+    }
+  }
+  return mismatches;
+}
+
+static double glyphs_per_second(sFONT* font) {
+  Paint paint(plain_image, W, H);
+  paint.SetRotate(ROTATE_180);
+  const char text[] = "CO2 1234 ppm";
+  long glyphs = 0;
+  double start = bench_seconds();
+  double elapsed;
+  do {
+    for (int i = 0; i < 200; i++) {
+      paint.DrawStringAt(2, 4, text, font, i & 1);
+      glyphs += sizeof(text) - 1;
+    }
+    elapsed = bench_seconds() - start;
+  } while (elapsed < 0.1);
+  bench_sink += plain_image[0];
+  return glyphs / elapsed;
+}
+
+int main(void) {
+  static Trimmed trimmed[FONT_COUNT];
+  printf("%-7s %8s %8s %7s %12s %12s\n", "font", "plain", "trimmed", "saved", "plain/s", "trimmed/s");
+  for (int f = 0; f < FONT_COUNT; f++) {
+    sFONT* plain = fonts[f];
+    Trimmed& t = trimmed[f];
+    trim(plain, &t);
+    int mismatches = 0;
+    for (int c = ' '; c <= '~'; c++) {
+      mismatches += compare(plain, &t.font, c);
+    }
+    CHECK_EQ(mismatches, 0);
+    unsigned int plainBytes = GLYPHS * plain->Height * ((plain->Width + 7) / 8);
+    unsigned int trimBytes = t.tableBytes + sizeof(t.glyphs);
+    printf("Font%-3d %8u %8u %6.0f%% %12.0f %12.0f\n", plain->Height, plainBytes, trimBytes,
+           100.0 - 100.0 * trimBytes / plainBytes,
+           glyphs_per_second(plain), glyphs_per_second(&t.font));
+    // The glyph boxes cost more than they save below 16 pixels, which
+    // is why only the large display fonts are trimmed
+    if (plain->Height >= 16) {
+      CHECK(trimBytes < plainBytes);
+    }
+  }
+
+  // The generated display subsets
+  sFONT* subsets[][2] = {
+    {&Font24, &Font24_Rot180}, {&Font20, &Font20_Rot180}, {&Font16, &Font16_Rot180}
+  };
+  for (int s = 0; s < 3; s++) {
+    int mismatches = 0, chars = 0;
+    for (int c = ' '; c <= '~'; c++) {
+      if (subsets[s][1]->index[c - ' '] != 0xFF) {
+        mismatches += compare(subsets[s][0], subsets[s][1], c);
+        chars++;
+      }
+    }
+    printf("Font%d_Rot180 %d characters checked\n", subsets[s][0]->Height, chars);
+    CHECK(chars > 0);
+    CHECK_EQ(mismatches, 0);
+  }
+  return test_result("test_font_trim");
+}
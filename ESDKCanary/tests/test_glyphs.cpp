@@ -0,0 +1,90 @@
+// Paint::DrawCharAt() blits glyph rows; RefPaint plots every pixel.
+// Random characters in every rotation, plain font and colour, clipped
+// at each edge, must leave identical buffers. Then glyphs per second
+// for both.
+#include <stdio.h>
+#include <string.h>
+#include "epdpaint.h"
+#include "refpaint.h"
+#include "testing.h"
+
+#define BUF_BYTES 2048
+#define RUNS 20000
+
+static sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (int)(sizeof(fonts) / sizeof(fonts[0]))
+
+// Band sizes, one with a width that is not a multiple of 8
+static const int sizes[][2] = {{120, 40}, {128, 32}, {100, 37}, {64, 64}};
+#define SIZE_COUNT (int)(sizeof(sizes) / sizeof(sizes[0]))
+
+static unsigned char ref_image[BUF_BYTES];
+static unsigned char new_image[BUF_BYTES];
+
+static void differential(void) {
+  int mismatches = 0;
+  for (int run = 0; run < RUNS; run++) {
+    int w = sizes[run % SIZE_COUNT][0];
+    int h = sizes[run % SIZE_COUNT][1];
+    int rotate = test_rand(4);
+    sFONT* font = fonts[test_rand(FONT_COUNT)];
+    int colored = test_rand(2);
+    // The drawing space is transposed for 90 and 270
+    int dw = rotate == ROTATE_90 || rotate == ROTATE_270 ? h : w;
+    int dh = rotate == ROTATE_90 || rotate == ROTATE_270 ? w : h;
+    int x = test_rand(dw + 2 * font->Width) - font->Width;
+    int y = test_rand(dh + 2 * font->Height) - font->Height;
+    char c = ' ' + test_rand(95);
+
+    for (int i = 0; i < BUF_BYTES; i++) {
+      ref_image[i] = new_image[i] = test_rand(256);
+    }
+    RefPaint ref(ref_image, w, h);
+    Paint paint(new_image, w, h);
+    ref.SetRotate(rotate);
+    paint.SetRotate(rotate);
+    ref.DrawCharAt(x, y, c, font, colored);
+    paint.DrawCharAt(x, y, c, font, colored);
+    if (memcmp(ref_image, new_image, BUF_BYTES) != 0 && mismatches++ < 5) {
+      printf("mismatch: %dx%d rotate %d font %dx%d '%c' at %d,%d colored %d\n",
+             w, h, rotate, font->Width, font->Height, c, x, y, colored);
+    }
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+template <typename P> static double glyphs_per_second(int rotate, sFONT* font) {
+  P paint(new_image, 120, 40);
+  paint.SetRotate(rotate);
+  const char text[] = "CO2 1234 ppm";
+  int glyphs = 0;
+  double start = bench_seconds();
+  double elapsed;
+  do {
+    for (int i = 0; i < 200; i++) {
+      paint.DrawStringAt(2, 4, text, font, i & 1);
+      glyphs += sizeof(text) - 1;
+    }
+    elapsed = bench_seconds() - start;
+  } while (elapsed < 0.2);
+  bench_sink += new_image[0];
+  return glyphs / elapsed;
+}
+
+static void bench(void) {
+  printf("%-8s %-6s %12s %12s %8s\n", "font", "rotate", "ref/s", "blit/s", "speedup");
+  for (int f = 0; f < FONT_COUNT; f += 2) {
+    for (int rotate = ROTATE_0; rotate <= ROTATE_180; rotate += 2) {
+      double ref = glyphs_per_second<RefPaint>(rotate, fonts[f]);
+      double blit = glyphs_per_second<Paint>(rotate, fonts[f]);
+      printf("Font%-4d %-6d %12.0f %12.0f %7.1fx\n", fonts[f]->Height, rotate * 90,
+             ref, blit, blit / ref);
+    }
+  }
+}
+
+int main(void) {
+  differential();
+  bench();
+  return test_result("test_glyphs");
+}
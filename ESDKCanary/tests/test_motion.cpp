@@ -0,0 +1,124 @@
+// The servo motion engine under a slow loop(). Each gesture runs once
+// with tick() every millisecond as the reference, then with longer and
+// uneven tick periods. The schedule keeps its own time, so after any
+// tick the wings are where the reference had them at that moment, and
+// the gesture ends when the reference does, give or take one tick.
+#include <stdio.h>
+#include "ESDKCanary.h"
+#include "emu.h"
+#include "testing.h"
+
+#define START_MS 1000
+#define MAX_MS 12000
+#define JITTER 0                // period 0 runs random ticks up to 200 ms apart
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+
+struct Run {
+  uint16_t at[MAX_MS];          // pulse length after the tick at each ms
+  unsigned long endMs;          // first tick with nothing left to move
+  unsigned long writes;
+  int mismatches;               // ticks where the wings were off the reference
+  unsigned long maxPeriod;
+};
+
+static Run reference;
+static Run run;
+
+static void start(ESDKCanary& canary, States state) {
+  canary.audioOn = false;
+  canary.demoOn = true;
+  canary.state = state;
+  canary.updateCanary();
+}
+
+static unsigned long next_period(unsigned long period) {
+  return period == JITTER ? 1 + test_rand(200) : period;
+}
+
+static void run_gesture(States state, unsigned long period, Run& r, const Run* ref) {
+  ESDKCanary canary(&sfx, &pwm, 0);
+  start(canary, state);
+  r.writes = 0;
+  r.mismatches = 0;
+  r.maxPeriod = 0;
+  unsigned long writes = emu.pwmWrites;
+  unsigned long t = START_MS;
+  while (t < MAX_MS) {
+    canary.tick(t);
+    r.at[t] = canary.getPulselen();
+    // The reference has stopped moving by its end
+    if (ref && ref->at[t < ref->endMs ? t : ref->endMs] != r.at[t]) {
+      r.mismatches++;
+    }
+    if (!canary.isMoving()) {
+      break;
+    }
+    unsigned long p = next_period(period);
+    if (p > r.maxPeriod) {
+      r.maxPeriod = p;
+    }
+    t += p;
+  }
+  r.endMs = t;
+  r.writes = emu.pwmWrites - writes;
+}
+
+static void check_gesture(const char* name, States state) {
+  run_gesture(state, 1, reference, NULL);
+  CHECK(reference.endMs < MAX_MS);
+  printf("%-12s %5lu ms, %4lu pulses\n", name, reference.endMs - START_MS, reference.writes);
+
+  static const unsigned long periods[] = {3, 17, 50, 333, JITTER};
+  for (unsigned int i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+    run_gesture(state, periods[i], run, &reference);
+    CHECK_EQ(run.mismatches, 0);
+    CHECK(run.endMs >= reference.endMs);
+    CHECK(run.endMs < reference.endMs + run.maxPeriod);
+    CHECK_EQ(run.at[run.endMs], reference.at[reference.endMs]);
+    CHECK(run.writes <= reference.writes);
+  }
+}
+
+// A motion queued after the engine sat idle, or in place of one that
+// was cut short, starts from the tick that finds it: it does not catch
+// up on the time before it was queued
+static void check_restart(void) {
+  ESDKCanary canary(&sfx, &pwm, 0);
+  start(canary, THATS_BETTER);
+  unsigned long t = START_MS;
+  while (canary.isMoving()) {
+    canary.tick(t++);
+  }
+  t += 5000;
+  canary.tick(t);
+  start(canary, OPEN_WINDOW);
+  uint16_t before = canary.getPulselen();
+  canary.tick(t + 1);
+  CHECK_EQ(before - canary.getPulselen(), 1);
+
+  // Cut the demo's two second pause short
+  start(canary, DEAD);
+  t += 100;
+  canary.tick(t);
+  while (canary.getPulselen() != WINGS_DOWN) {
+    canary.tick(++t);
+  }
+  t += 1500;
+  canary.tick(t);
+  start(canary, STUFFY);
+  before = canary.getPulselen();
+  canary.tick(t + 1);
+  CHECK_EQ(before - canary.getPulselen(), 1);
+}
+
+int main(void) {
+  check_gesture("stuffy", STUFFY);
+  check_gesture("open window", OPEN_WINDOW);
+  check_gesture("pass out", PASS_OUT);
+  check_gesture("better", THATS_BETTER);
+  check_gesture("dead demo", DEAD);
+  check_restart();
+  return test_result("test_motion");
+}
@@ -0,0 +1,79 @@
+// UnpackBits_P() and EpdIf::SpiTransferPackBits_P() share one decoder.
+// Random packed frames, with no-op 0x80 controls and runs cut short by
+// the length, must decode to the same bytes in RAM and in panel RAM.
+#include <stdio.h>
+#include <string.h>
+#include "epd2in9_V2.h"
+#include "packbits.h"
+#include "emu.h"
+#include "testing.h"
+
+#define FRAME_BYTES (EPD_WIDTH / 8 * EPD_HEIGHT)
+
+static unsigned char plain[FRAME_BYTES + 256];
+static unsigned char packed[2 * FRAME_BYTES];
+static unsigned char unpacked[FRAME_BYTES];
+
+// Packs len bytes of plain, with a 0x80 now and then
+static unsigned int pack(unsigned int len) {
+  unsigned int in = 0, out = 0;
+  while (in < len) {
+    if (test_rand(16) == 0) {
+      packed[out++] = 0x80;
+    }
+    unsigned int run = 1;
+    while (in + run < len && run < 128 && plain[in + run] == plain[in]) {
+      run++;
+    }
+    if (run > 1) {
+      packed[out++] = 257 - run;
+      packed[out++] = plain[in];
+      in += run;
+      continue;
+    }
+    unsigned int lit = 1;
+    while (in + lit < len && lit < 128 && plain[in + lit] != plain[in + lit - 1]) {
+      lit++;
+    }
+    packed[out++] = lit - 1;
+    memcpy(&packed[out], &plain[in], lit);
+    out += lit;
+    in += lit;
+  }
+  return out;
+}
+
+int main(void) {
+  Epd epd;
+  CHECK_EQ(epd.Init(), 0);
+  for (int run = 0; run < 50; run++) {
+    // Runs of repeats and noise
+    for (unsigned int i = 0; i < sizeof(plain); ) {
+      unsigned int n = 1 + test_rand(200);
+      unsigned char v = test_rand(256);
+      bool repeat = test_rand(2);
+      for (unsigned int k = 0; k < n && i < sizeof(plain); k++, i++) {
+        plain[i] = repeat ? v : test_rand(256);
+      }
+    }
+    // Packed past the frame, so the last run is cut short
+    pack(FRAME_BYTES + test_rand(200));
+
+    memset(unpacked, 0xA5, sizeof(unpacked));
+    UnpackBits_P(packed, unpacked, FRAME_BYTES);
+    CHECK_EQ(memcmp(unpacked, plain, FRAME_BYTES), 0);
+
+    epd.SetFrameMemory_Base_PackBits(packed);
+    epd.WaitUntilIdle();
+    int wrong = 0;
+    for (int y = 0; y < EPD_HEIGHT; y++) {
+      for (int x = 0; x < EPD_WIDTH / 8; x++) {
+        wrong += emu_ram(0, y, x) != plain[y * (EPD_WIDTH / 8) + x];
+        wrong += emu_ram(1, y, x) != plain[y * (EPD_WIDTH / 8) + x];
+      }
+    }
+    CHECK_EQ(wrong, 0);
+  }
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_packbits");
+}
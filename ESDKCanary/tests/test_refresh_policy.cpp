@@ -0,0 +1,154 @@
+// Full refreshes clear ghosting but flash the whole panel, so the
+// policy has a budget: no two within minIntervalMs, and one at least
+// every 2 * maxAgeMs while partials keep coming. Simulated days of
+// readings check it on its own and through CanaryDisplay, with the
+// full refreshes counted on the panel model.
+#include <stdio.h>
+#include "CanaryDisplay.h"
+#include "emu.h"
+#include "testing.h"
+
+#define HOUR_MS (60UL * 60 * 1000)
+#define DAY_MS (24 * HOUR_MS)
+
+// Readings change every period ms in the day, hourly at night
+static unsigned long update_period(unsigned long now) {
+  unsigned long hour = now / HOUR_MS % 24;
+  return hour >= 8 && hour < 20 ? 10000 : HOUR_MS;
+}
+
+struct Budget {
+  unsigned long fulls;
+  unsigned long minGapMs;
+  unsigned long maxGapMs;       // between fulls while partials were pending
+  unsigned long maxPartials;    // partials between two fulls
+  unsigned long lastFull;
+  unsigned long partials;
+
+  void reset(unsigned long now) {
+    fulls = 0;
+    minGapMs = 0xFFFFFFFFUL;
+    maxGapMs = 0;
+    maxPartials = 0;
+    lastFull = now;
+    partials = 0;
+  }
+  void partial(void) {
+    partials++;
+  }
+  void full(unsigned long now) {
+    unsigned long gap = now - lastFull;
+    minGapMs = gap < minGapMs ? gap : minGapMs;
+    maxGapMs = partials && gap > maxGapMs ? gap : maxGapMs;
+    maxPartials = partials > maxPartials ? partials : maxPartials;
+    lastFull = now;
+    partials = 0;
+    fulls++;
+  }
+};
+
+static void report(const char* name, const Budget& b, unsigned long days) {
+  printf("%-22s %5.1f fulls/day, gaps %lu..%lu min, <= %lu partials between\n",
+         name, (double)b.fulls / days, b.minGapMs / 60000, b.maxGapMs / 60000, b.maxPartials);
+}
+
+// The policy alone over a week, polled every second
+static void policy_days(const char* name, const RefreshPolicyConfig& config) {
+  RefreshPolicy policy;
+  policy.config = config;
+  Budget b;
+  b.reset(0);
+  unsigned long next = 0;
+  for (unsigned long now = 1000; now < 7 * DAY_MS; now += 1000) {
+    if (policy.due(now)) {
+      policy.noteFull(now, true);
+      b.full(now);
+    }
+    if (now >= next) {
+      policy.notePartial(now, 40UL * 120);
+      b.partial();
+      next = now + update_period(now);
+    }
+  }
+  report(name, b, 7);
+  CHECK(b.fulls > 0);
+  CHECK(b.minGapMs >= config.minIntervalMs);
+  if (config.maxAgeMs) {
+    CHECK(b.maxGapMs <= 2 * config.maxAgeMs + 1000);
+  }
+  if (config.maxPartials && !config.minIntervalMs && !config.quietMs) {
+    CHECK_EQ(b.maxPartials, config.maxPartials);
+  }
+  CHECK_EQ(policy.counters.scheduledFulls, b.fulls);
+}
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+static ESDKCanary canary(&sfx, &pwm, 0);
+static CanaryDisplay display(&canary);
+static Budget panel;
+
+// Counts updates on the panel by the 0x22 mode they run with
+static void on_command(uint8_t command) {
+  if (command != 0x20) {
+    return;
+  }
+  uint8_t mode = emu_last_update_mode();
+  if (mode == 0xC7 || mode == 0xF7) {
+    panel.full(millis());
+  } else if (mode == 0x0F || mode == 0xFF) {
+    panel.partial();
+  }
+}
+
+// A day of readings on the display, loop() every 50 ms
+static void display_day(void) {
+  display.initDisplay();
+  while (display.isBusy()) {
+    display.pollDisplay();
+    emu_advance_us(50000);
+  }
+  unsigned long start = millis();
+  panel.reset(start);
+  emu_hooks.command = on_command;
+  unsigned long next = start;
+  int step = 0;
+  while (millis() - start < DAY_MS) {
+    display.pollDisplay();
+    if ((long)(millis() - next) >= 0) {
+      canary.co2 = 500 + (step * 37) % 700;
+      canary.temperature = 20 + (step % 30) / 10.0;
+      step++;
+      display.updateDisplay();
+      next = millis() + update_period(millis() - start);
+    }
+    emu_advance_us(50000);
+  }
+  emu_hooks.command = NULL;
+  report("display, defaults", panel, 1);
+  printf("%lu partials, %lu fulls on the panel\n", emu.partials, emu.fulls);
+  const RefreshPolicyConfig& config = display.refreshPolicy.config;
+  CHECK(panel.fulls > 0);
+  CHECK(panel.minGapMs >= config.minIntervalMs);
+  CHECK(panel.maxGapMs <= 2 * config.maxAgeMs + 1000);
+  CHECK_EQ(display.refreshPolicy.counters.scheduledFulls, panel.fulls);
+  CHECK_EQ(emu_errors(), 0);
+}
+
+int main(void) {
+  RefreshPolicy defaults;
+  policy_days("defaults", defaults.config);
+
+  RefreshPolicyConfig every2 = {2, 0, 0, 0, 0};
+  policy_days("maxPartials=2", every2);
+
+  RefreshPolicyConfig tight = {2, 0, 0, 0, 30UL * 60 * 1000};
+  policy_days("maxPartials=2, 30 min", tight);
+
+  RefreshPolicyConfig aged = {0, 0, HOUR_MS, 15000, 0};
+  policy_days("maxAge=1h only", aged);
+
+  display.panelPower.config.sleepAfterMs = 0;
+  display_day();
+  return test_result("test_refresh_policy");
+}
@@ -0,0 +1,107 @@
+// BasicPaint fixes rotation and size at compile time; Paint picks the
+// same kernels at run time. Random drawing through both must give the
+// same buffers in every rotation. Then the cost per DrawPixel() call of
+// RefPaint, Paint and BasicPaint.
+#include <stdio.h>
+#include <string.h>
+#include "basicpaint.h"
+#include "refpaint.h"
+#include "testing.h"
+
+#define W 120
+#define H 40
+#define BUF_BYTES (W / 8 * H)
+#define RUNS 5000
+
+static sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (int)(sizeof(fonts) / sizeof(fonts[0]))
+
+static unsigned char run_image[BUF_BYTES];
+static unsigned char fixed_image[BUF_BYTES];
+
+// One random call, the same on any painter. v[] is -20..W+19; the
+// character, scale and radius are taken from it as non-negative values.
+template <typename P> static void draw(P& paint, int op, const int* v, int colored) {
+  int n = v[2] + 20;
+  switch (op) {
+    case 0: paint.DrawPixel(v[0], v[1], colored); break;
+    case 1: paint.DrawCharAt(v[0], v[1], ' ' + n % 95, fonts[(v[3] + 20) % FONT_COUNT], colored); break;
+    case 2: paint.DrawStringAt(v[0], v[1], "12:34", fonts[(v[3] + 20) % FONT_COUNT], colored, 1 + n % 3); break;
+    case 3: paint.DrawLine(v[0], v[1], v[2], v[3], colored); break;
+    case 4: paint.DrawFilledRectangle(v[0], v[1], v[2], v[3], colored); break;
+    case 5: paint.DrawRectangle(v[0], v[1], v[2], v[3], colored); break;
+    case 6: paint.DrawFilledCircle(v[0], v[1], n % 30, colored); break;
+  }
+}
+
+template <int Rotation> static int differential(void) {
+  int mismatches = 0;
+  for (int run = 0; run < RUNS; run++) {
+    int op = test_rand(7);
+    int v[4];
+    for (int i = 0; i < 4; i++) {
+      v[i] = test_rand(W + 40) - 20;
+    }
+    int colored = test_rand(2);
+    for (int i = 0; i < BUF_BYTES; i++) {
+      run_image[i] = fixed_image[i] = test_rand(256);
+    }
+    Paint paint(run_image, W, H);
+    paint.SetRotate(Rotation);
+    BasicPaint<Rotation, W, H> fixed(fixed_image);
+    draw(paint, op, v, colored);
+    draw(fixed, op, v, colored);
+    if (memcmp(run_image, fixed_image, BUF_BYTES) != 0 && mismatches++ < 5) {
+      printf("mismatch: rotate %d op %d (%d, %d, %d, %d) colored %d\n",
+             Rotation, op, v[0], v[1], v[2], v[3], colored);
+    }
+  }
+  return mismatches;
+}
+
+// ns per pixel for a sweep of the logical area, every pixel set
+template <typename P> static double ns_per_pixel(P& paint, int lw, int lh) {
+  long pixels = 0;
+  double start = bench_seconds();
+  double elapsed;
+  do {
+    for (int y = 0; y < lh; y++) {
+      for (int x = 0; x < lw; x++) {
+        paint.DrawPixel(x, y, (x ^ y) & 1);
+      }
+    }
+    pixels += lw * lh;
+    elapsed = bench_seconds() - start;
+  } while (elapsed < 0.1);
+  bench_sink += run_image[0] + fixed_image[0];
+  return elapsed * 1e9 / pixels;
+}
+
+template <int Rotation> static void bench(void) {
+  bool turned = Rotation == ROTATE_90 || Rotation == ROTATE_270;
+  int lw = turned ? H : W;
+  int lh = turned ? W : H;
+  RefPaint ref(run_image, W, H);
+  ref.SetRotate(Rotation);
+  Paint paint(run_image, W, H);
+  paint.SetRotate(Rotation);
+  BasicPaint<Rotation, W, H> fixed(fixed_image);
+  double r = ns_per_pixel(ref, lw, lh);
+  double p = ns_per_pixel(paint, lw, lh);
+  double f = ns_per_pixel(fixed, lw, lh);
+  printf("%6d %10.2f %10.2f %10.2f %7.1fx\n", Rotation * 90, r, p, f, r / f);
+}
+
+int main(void) {
+  CHECK_EQ(differential<ROTATE_0>(), 0);
+  CHECK_EQ(differential<ROTATE_90>(), 0);
+  CHECK_EQ(differential<ROTATE_180>(), 0);
+  CHECK_EQ(differential<ROTATE_270>(), 0);
+
+  printf("%6s %10s %10s %10s %8s\n", "rotate", "ref ns", "Paint ns", "Basic ns", "speedup");
+  bench<ROTATE_0>();
+  bench<ROTATE_90>();
+  bench<ROTATE_180>();
+  bench<ROTATE_270>();
+  return test_result("test_rotation");
+}
@@ -0,0 +1,174 @@
+// DrawStringAt() with a scale fills one span per run of set bits. It
+// must match drawing each glyph pixel as a scale x scale block of
+// RefPaint::DrawPixel() calls, in every rotation, and the display's
+// large readings must match the golden images in golden/. Run with -u
+// to rewrite them. Then strings per second against a native font of
+// the same height.
+#include <stdio.h>
+#include <string.h>
+#include "epdpaint.h"
+#include "basicpaint.h"
+#include "refpaint.h"
+#include "testing.h"
+
+#define W 120
+#define H 40
+#define BUF_BYTES 2048
+#define RUNS 3000
+
+static sFONT* fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (int)(sizeof(fonts) / sizeof(fonts[0]))
+
+static unsigned char ref_image[BUF_BYTES];
+static unsigned char new_image[BUF_BYTES];
+
+// The scaled string, one block of pixels per glyph pixel
+static void ref_draw_scaled(RefPaint& paint, int x, int y, const char* text,
+                            sFONT* font, int colored, int scale) {
+  int row_bytes = (font->Width + 7) / 8;
+  for (; *text; text++, x += font->Width * scale) {
+    const uint8_t* glyph = &font->table[(*text - ' ') * font->Height * row_bytes];
+    for (int j = 0; j < font->Height; j++) {
+      for (int i = 0; i < font->Width; i++) {
+        if (!(glyph[j * row_bytes + i / 8] & (0x80 >> (i % 8)))) {
+          continue;
+        }
+        for (int dy = 0; dy < scale; dy++) {
+          for (int dx = 0; dx < scale; dx++) {
+            paint.DrawPixel(x + i * scale + dx, y + j * scale + dy, colored);
+          }
+        }
+      }
+    }
+  }
+}
+
+static void differential(void) {
+  static const char* texts[] = {"0", "1234", "88.8", "ppm", "-7%", "C"};
+  int mismatches = 0;
+  for (int run = 0; run < RUNS; run++) {
+    int rotate = test_rand(4);
+    sFONT* font = fonts[test_rand(FONT_COUNT)];
+    const char* text = texts[test_rand(6)];
+    int scale = 2 + test_rand(3);
+    int colored = test_rand(2);
+    int x = test_rand(W + 40) - 40;
+    int y = test_rand(W + 40) - 40;
+    for (int i = 0; i < BUF_BYTES; i++) {
+      ref_image[i] = new_image[i] = test_rand(256);
+    }
+    RefPaint ref(ref_image, W, H);
+    Paint paint(new_image, W, H);
+    ref.SetRotate(rotate);
+    paint.SetRotate(rotate);
+    ref_draw_scaled(ref, x, y, text, font, colored, scale);
+    paint.DrawStringAt(x, y, text, font, colored, scale);
+    if (memcmp(ref_image, new_image, BUF_BYTES) != 0 && mismatches++ < 5) {
+      printf("mismatch: rotate %d font %d \"%s\" x%d at %d,%d\n",
+             rotate, font->Height, text, scale, x, y);
+    }
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+// Large readings as CanaryDisplay draws them, one band each
+struct Golden {
+  const char* name;
+  const char* text;
+  sFONT* font;
+  int scale;
+};
+
+static const Golden goldens[] = {
+  {"co2_large", "1234", &Font20_Rot180, 2},
+  {"co2_large_plain", "1234", &Font20, 2},
+  {"temp_x3", "21.5", &Font12, 3},
+  {"digits_x4", "88", &Font8, 4},
+};
+
+static bool read_pbm(const char* path, unsigned char* image, int bytes) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  int w, h;
+  bool ok = fscanf(f, "P4 %d %d", &w, &h) == 2 && w == W && h == H && fgetc(f) != EOF &&
+            (int)fread(image, 1, bytes, f) == bytes;
+  fclose(f);
+  return ok;
+}
+
+static bool write_pbm(const char* path, const unsigned char* image, int bytes) {
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    return false;
+  }
+  fprintf(f, "P4\n%d %d\n", W, H);
+  fwrite(image, 1, bytes, f);
+  fclose(f);
+  return true;
+}
+
+static void check_goldens(bool update) {
+  const int bytes = W / 8 * H;
+  for (unsigned int g = 0; g < sizeof(goldens) / sizeof(goldens[0]); g++) {
+    // PBM has bit set = black, as IF_INVERT_COLOR draws COLORED
+    BasicPaint<ROTATE_180, W, H> paint(new_image);
+    paint.Clear(0);
+    paint.DrawStringAt(2, 0, goldens[g].text, goldens[g].font, 1, goldens[g].scale);
+    char path[64];
+    snprintf(path, sizeof(path), "golden/%s.pbm", goldens[g].name);
+    if (update) {
+      CHECK(write_pbm(path, new_image, bytes));
+      continue;
+    }
+    if (!CHECK(read_pbm(path, ref_image, bytes))) {
+      continue;
+    }
+    if (memcmp(ref_image, new_image, bytes) != 0) {
+      printf("%s differs from %s\n", goldens[g].name, path);
+      test_failures++;
+    }
+  }
+}
+
+template <typename P> static double strings_per_second(sFONT* font, int scale) {
+  P paint(new_image, W, H);
+  paint.SetRotate(ROTATE_180);
+  long strings = 0;
+  double start = bench_seconds();
+  double elapsed;
+  do {
+    for (int i = 0; i < 100; i++) {
+      paint.DrawStringAt(2, 0, "1234", font, i & 1, scale);
+    }
+    strings += 100;
+    elapsed = bench_seconds() - start;
+  } while (elapsed < 0.1);
+  bench_sink += new_image[0];
+  return strings / elapsed;
+}
+
+// RefPaint drawing blocks of pixels, for the same call shape
+struct RefScaled : RefPaint {
+  RefScaled(unsigned char* image, int width, int height) : RefPaint(image, width, height) {}
+  void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored, int scale) {
+    ref_draw_scaled(*this, x, y, text, font, colored, scale);
+  }
+};
+
+static void bench(void) {
+  printf("%-16s %12s\n", "\"1234\"", "strings/s");
+  printf("%-16s %12.0f\n", "Font12 x2 ref", strings_per_second<RefScaled>(&Font12, 2));
+  printf("%-16s %12.0f\n", "Font12 x2 spans", strings_per_second<Paint>(&Font12, 2));
+  printf("%-16s %12.0f\n", "Font24 native", strings_per_second<Paint>(&Font24, 1));
+  printf("%-16s %12.0f\n", "Font20 x2 spans", strings_per_second<Paint>(&Font20, 2));
+}
+
+int main(int argc, char** argv) {
+  bool update = argc > 1 && strcmp(argv[1], "-u") == 0;
+  differential();
+  check_goldens(update);
+  bench();
+  return test_result("test_scaled");
+}
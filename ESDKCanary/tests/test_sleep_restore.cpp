@@ -0,0 +1,93 @@
+// Deep sleep mode 2 loses both RAM planes. After waking, the display
+// must rewrite them so the next partial update lands on what is really
+// on screen: the panel RAM has to end up as it would without the sleep.
+#include <stdio.h>
+#include "CanaryDisplay.h"
+#include "emu.h"
+#include "testing.h"
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+static ESDKCanary canary(&sfx, &pwm, 0);
+
+// 0x24 as the panel went to sleep, which is what it shows, and 0x26 as
+// the first partial refresh after waking starts
+static unsigned long shown = 0;
+static unsigned long old = 0;
+static bool woken = false;
+
+static void on_command(uint8_t command) {
+  if (command == 0x10) {
+    shown = emu_hash(0);
+    woken = true;
+  } else if (command == 0x20 && woken && emu_last_update_mode() == 0x0F) {
+    old = emu_hash(1);
+    woken = false;
+  }
+}
+
+static void run_until_idle(CanaryDisplay& display, unsigned long ms) {
+  unsigned long start = millis();
+  do {
+    display.pollDisplay();
+    emu_advance_us(1000);
+  } while (display.isBusy() || millis() - start < ms);
+}
+
+// Readings, a long idle spell, then new readings
+static void run(CanaryDisplay& display, unsigned long hash[2]) {
+  display.refreshPolicy.config.maxPartials = 0;
+  display.refreshPolicy.config.maxArea = 0;
+  display.refreshPolicy.config.maxAgeMs = 0;
+  display.initDisplay();
+  run_until_idle(display, 0);
+  canary.co2 = 700;
+  display.updateDisplay();
+  run_until_idle(display, 0);
+  canary.co2 = 900;
+  canary.temperature = 23.5;
+  display.updateDisplay();
+  run_until_idle(display, 120000);
+  canary.co2 = 1300;
+  canary.humidity = 51.2;
+  display.updateDisplay();
+  run_until_idle(display, 0);
+  hash[0] = emu_hash(0);
+  hash[1] = emu_hash(1);
+}
+
+int main(void) {
+  unsigned long awake[2], slept[2];
+
+  CanaryDisplay steady(&canary);
+  steady.panelPower.config.sleepAfterMs = 0;
+  run(steady, awake);
+  CHECK_EQ(steady.panelPower.counters.sleeps, 0);
+
+  CanaryDisplay sleeper(&canary);
+  sleeper.panelPower.config.sleepAfterMs = 60000;
+  sleeper.panelPower.config.keepRam = false;
+  unsigned long dma = emu.dmaBytes;
+  emu_hooks.command = on_command;
+  run(sleeper, slept);
+  emu_hooks.command = NULL;
+  printf("sleeps %lu, restores %lu, last wake %.1f ms, %lu bytes in the background\n",
+         sleeper.panelPower.counters.sleeps, sleeper.panelPower.counters.restores,
+         sleeper.panelPower.counters.lastWakeUs / 1000.0, emu.dmaBytes - dma);
+  CHECK(sleeper.panelPower.counters.sleeps >= 1);
+  CHECK(sleeper.panelPower.counters.restores >= 1);
+  // 0x24 is what the next refresh shows. The model leaves 0x26 as it
+  // was last written rather than copying 0x24 into it after a refresh,
+  // so the runs are only compared on 0x24. The partial waveform reads
+  // 0x26 as the old image: when the refresh after waking starts it must
+  // hold the screen from before the sleep, not the new readings.
+  CHECK_EQ(slept[0], awake[0]);
+  CHECK(shown != 0);
+  CHECK_EQ(old, shown);
+#if CANARY_FRAMEBUFFER
+  // The frame is restored from RAM through the background transport
+  CHECK(emu.dmaBytes - dma >= 2UL * EPD_WIDTH / 8 * EPD_HEIGHT);
+#endif
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_sleep_restore");
+}
@@ -0,0 +1,117 @@
+// Clear(), lines, rectangles and circles fill byte spans in Paint and
+// plot pixels in RefPaint. Random shapes in every rotation and colour,
+// clipped at each edge, must leave identical buffers. Then the time
+// per call of each primitive for both.
+#include <stdio.h>
+#include <string.h>
+#include "epdpaint.h"
+#include "refpaint.h"
+#include "testing.h"
+
+#define BUF_BYTES 2048
+#define RUNS 20000
+
+enum Shapes {CLEAR, LINE, HLINE, VLINE, RECT, FILLED_RECT, CIRCLE, FILLED_CIRCLE, SHAPE_COUNT};
+
+static const char* names[SHAPE_COUNT] = {
+  "Clear", "Line", "HLine", "VLine", "Rect", "FilledRect", "Circle", "FilledCircle"
+};
+
+static const int sizes[][2] = {{120, 40}, {128, 32}, {100, 37}, {64, 64}};
+#define SIZE_COUNT (int)(sizeof(sizes) / sizeof(sizes[0]))
+
+static unsigned char ref_image[BUF_BYTES];
+static unsigned char new_image[BUF_BYTES];
+
+struct Shape {
+  int kind;
+  int a, b, c, d;
+  int colored;
+};
+
+template <typename P> static void draw(P& paint, const Shape& s) {
+  switch (s.kind) {
+    case CLEAR: paint.Clear(s.colored); break;
+    case LINE: paint.DrawLine(s.a, s.b, s.c, s.d, s.colored); break;
+    case HLINE: paint.DrawHorizontalLine(s.a, s.b, s.c, s.colored); break;
+    case VLINE: paint.DrawVerticalLine(s.a, s.b, s.d, s.colored); break;
+    case RECT: paint.DrawRectangle(s.a, s.b, s.c, s.d, s.colored); break;
+    case FILLED_RECT: paint.DrawFilledRectangle(s.a, s.b, s.c, s.d, s.colored); break;
+    case CIRCLE: paint.DrawCircle(s.a, s.b, s.c % 40, s.colored); break;
+    case FILLED_CIRCLE: paint.DrawFilledCircle(s.a, s.b, s.c % 40, s.colored); break;
+  }
+}
+
+static void differential(void) {
+  int mismatches = 0;
+  for (int run = 0; run < RUNS; run++) {
+    int w = sizes[run % SIZE_COUNT][0];
+    int h = sizes[run % SIZE_COUNT][1];
+    int rotate = test_rand(4);
+    int span = (w > h ? w : h) + 40;
+    Shape s;
+    s.kind = test_rand(SHAPE_COUNT);
+    s.a = test_rand(span) - 20;
+    s.b = test_rand(span) - 20;
+    s.c = test_rand(span) - 20;
+    s.d = test_rand(span) - 20;
+    s.colored = test_rand(2);
+    for (int i = 0; i < BUF_BYTES; i++) {
+      ref_image[i] = new_image[i] = test_rand(256);
+    }
+    RefPaint ref(ref_image, w, h);
+    Paint paint(new_image, w, h);
+    ref.SetRotate(rotate);
+    paint.SetRotate(rotate);
+    draw(ref, s);
+    draw(paint, s);
+    if (memcmp(ref_image, new_image, BUF_BYTES) != 0 && mismatches++ < 5) {
+      printf("mismatch: %dx%d rotate %d %s(%d, %d, %d, %d) colored %d\n",
+             w, h, rotate, names[s.kind], s.a, s.b, s.c, s.d, s.colored);
+    }
+  }
+  CHECK_EQ(mismatches, 0);
+}
+
+template <typename P> static double us_per_call(const Shape& s) {
+  P paint(new_image, 120, 40);
+  paint.SetRotate(ROTATE_180);
+  long calls = 0;
+  double start = bench_seconds();
+  double elapsed;
+  do {
+    for (int i = 0; i < 100; i++) {
+      draw(paint, s);
+    }
+    calls += 100;
+    elapsed = bench_seconds() - start;
+  } while (elapsed < 0.1);
+  bench_sink += new_image[0];
+  return elapsed * 1e6 / calls;
+}
+
+static void bench(void) {
+  // Typical band sized shapes, the clear covers the whole band
+  static const Shape shapes[SHAPE_COUNT] = {
+    {CLEAR, 0, 0, 0, 0, 1},
+    {LINE, 3, 2, 110, 37, 0},
+    {HLINE, 3, 20, 110, 0, 0},
+    {VLINE, 60, 2, 0, 36, 0},
+    {RECT, 3, 2, 110, 37, 0},
+    {FILLED_RECT, 3, 2, 110, 37, 0},
+    {CIRCLE, 60, 20, 18, 0, 0},
+    {FILLED_CIRCLE, 60, 20, 18, 0, 0},
+  };
+  printf("%-14s %10s %10s %8s\n", "120x40 band", "ref us", "span us", "speedup");
+  for (int i = 0; i < SHAPE_COUNT; i++) {
+    double ref = us_per_call<RefPaint>(shapes[i]);
+    double span = us_per_call<Paint>(shapes[i]);
+    printf("%-14s %10.3f %10.3f %7.1fx\n", names[i], ref, span, ref / span);
+  }
+}
+
+int main(void) {
+  differential();
+  bench();
+  return test_result("test_spans");
+}
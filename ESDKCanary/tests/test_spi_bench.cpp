@@ -0,0 +1,160 @@
+// Frame upload throughput, in modelled SAMD21 time: the original
+// Waveshare path (a digitalWrite() for DC and CS around every byte at
+// 2 MHz) against SetFrameMemory() sending the frame as one block.
+// Both must leave the same image in panel RAM. Then the cost of one
+// SendData() byte, with the control pins behind digitalWrite() and as
+// the port register stores EpdPin makes on SAMD.
+#include <stdio.h>
+#include <SPI.h>
+#include "epd2in9_V2.h"
+#include "emu.h"
+#include "testing.h"
+
+#define FRAME_BYTES (EPD_WIDTH / 8 * EPD_HEIGHT)
+#define SINGLE_BYTES 1000
+// A PORT OUTSET/OUTCLR store on a 48 MHz SAMD21, two cycles
+#define PORT_STORE_US 0.042
+
+static unsigned char frame[FRAME_BYTES];
+
+// The original ran the whole bus at 2 MHz; as a client it also takes
+// the bus back from the panel driver
+static SpiBusClient ref_bus(SPISettings(2000000, MSBFIRST, SPI_MODE0), 0);
+
+// Epd::SendCommand()/SendData() and EpdIf::SpiTransfer() as shipped
+static void ref_send(int dc, unsigned char value) {
+  digitalWrite(DC_PIN, dc);
+  digitalWrite(CS_PIN, LOW);
+  digitalWrite(CS_PIN, LOW);
+  SPI.transfer(value);
+  digitalWrite(CS_PIN, HIGH);
+  digitalWrite(CS_PIN, HIGH);
+}
+
+static void ref_command(unsigned char command) {
+  ref_send(LOW, command);
+}
+
+static void ref_data(unsigned char data) {
+  ref_send(HIGH, data);
+}
+
+static void ref_upload(void) {
+  spiBus.acquire(ref_bus);
+  ref_command(0x44);
+  ref_data(0x00);
+  ref_data(EPD_WIDTH / 8 - 1);
+  ref_command(0x45);
+  ref_data(0x00);
+  ref_data(0x00);
+  ref_data((EPD_HEIGHT - 1) & 0xFF);
+  ref_data((EPD_HEIGHT - 1) >> 8);
+  ref_command(0x4E);
+  ref_data(0x00);
+  ref_command(0x4F);
+  ref_data(0x00);
+  ref_data(0x00);
+  ref_command(0x24);
+  for (int i = 0; i < FRAME_BYTES; i++) {
+    ref_data(frame[i]);
+  }
+  spiBus.release(ref_bus);
+}
+
+struct Upload {
+  double us;
+  unsigned long pinCalls;
+  unsigned long hash;
+};
+
+template <typename F> static Upload measure(F upload) {
+  unsigned long pins = emu.pinCalls;
+  double start = emu_now_us();
+  upload();
+  Upload u;
+  u.us = emu_now_us() - start;
+  u.pinCalls = emu.pinCalls - pins;
+  u.hash = emu_hash(0);
+  return u;
+}
+
+static void report(const char* name, const Upload& u) {
+  printf("%-10s %8.1f ms %8.0f bytes/s %6.2f pin calls/byte\n", name,
+         u.us / 1000, FRAME_BYTES / (u.us / 1e6), (double)u.pinCalls / FRAME_BYTES);
+}
+
+struct PerByte {
+  double us;
+  double pinCalls;
+  double transactions;
+};
+
+template <typename F> static PerByte per_byte(F send) {
+  unsigned long pins = emu.pinCalls;
+  unsigned long transactions = emu.transactions;
+  double start = emu_now_us();
+  for (int i = 0; i < SINGLE_BYTES; i++) {
+    send((unsigned char)i);
+  }
+  PerByte b;
+  b.us = (emu_now_us() - start) / SINGLE_BYTES;
+  b.pinCalls = (double)(emu.pinCalls - pins) / SINGLE_BYTES;
+  b.transactions = (double)(emu.transactions - transactions) / SINGLE_BYTES;
+  return b;
+}
+
+static void report_byte(const char* name, const PerByte& b) {
+  printf("%-22s %6.2f us/byte %5.2f pin writes/byte %5.3f transactions/byte\n",
+         name, b.us, b.pinCalls, b.transactions);
+}
+
+static void single_bytes(Epd& epd) {
+  double pin_us = emu_costs.pinCallUs;
+  spiBus.acquire(ref_bus);
+  PerByte ref = per_byte(ref_data);
+  spiBus.release(ref_bus);
+  PerByte pins = per_byte([&](unsigned char b) { epd.SendData(b); });
+  emu_costs.pinCallUs = PORT_STORE_US;
+  PerByte port = per_byte([&](unsigned char b) { epd.SendData(b); });
+  emu_costs.pinCallUs = pin_us;
+
+  report_byte("SendData, original", ref);
+  report_byte("SendData, digitalWrite", pins);
+  report_byte("SendData, port stores", port);
+  CHECK(ref.pinCalls == 5);
+  CHECK(pins.pinCalls == 3);
+  CHECK(port.us < pins.us);
+  // The bus is taken once for a run of single bytes
+  CHECK(pins.transactions < 0.01);
+}
+
+int main(void) {
+  for (int i = 0; i < FRAME_BYTES; i++) {
+    frame[i] = (i * 37) ^ (i >> 4);
+  }
+
+  Epd epd;
+  CHECK_EQ(epd.Init(), 0);
+  epd.WaitUntilIdle();
+
+  Upload ref = measure(ref_upload);
+  epd.ClearFrameMemory(0xFF);
+  epd.WaitUntilIdle();
+  CHECK(emu_hash(0) != ref.hash);
+
+  Upload block = measure([&]() {
+    epd.SetFrameMemory(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+    epd.SendCommand(0x7F);   // NOP, waits for the block to go out
+  });
+
+  report("per byte", ref);
+  report("block", block);
+  printf("speedup    %8.1fx\n", ref.us / block.us);
+  single_bytes(epd);
+
+  CHECK_EQ(block.hash, ref.hash);
+  CHECK(block.us * 10 < ref.us);
+  CHECK(block.pinCalls * 100 < ref.pinCalls);
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_spi_bench");
+}
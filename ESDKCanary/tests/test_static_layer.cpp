@@ -0,0 +1,115 @@
+// The labels are a static layer: both RAM planes hold them so later
+// partial refreshes leave them alone. When the readings screen replaces
+// another scene, or changes layout, the partial waveform only drives
+// pixels where 0x24 differs from 0x26, so 0x26 must still hold the old
+// scene under the new labels when that first refresh starts. Once it
+// is done the labels go to 0x26 too, and value updates skip them.
+#include <stdio.h>
+#include <string.h>
+#include "CanaryDisplay.h"
+#include "emu.h"
+#include "testing.h"
+
+static Adafruit_PWMServoDriver pwm;
+static Adafruit_Soundboard sfx;
+static ESDKCanary canary(&sfx, &pwm, 0);
+static CanaryDisplay display(&canary);
+
+struct Rows {
+  int y0;
+  int y1;
+};
+
+// Panel rows owned by the labels of each layout, see CanaryDisplay.cpp
+static const Rows READINGS_LABELS[] = {{270, 289}, {220, 239}, {170, 189}, {120, 139}, {70, 89}};
+static const Rows LARGE_CO2_LABELS[] = {{250, 289}, {180, 209}, {80, 119}};
+
+static uint8_t before[EMU_PANEL_ROWS][EMU_PANEL_BYTES];
+
+static void wait_idle(void) {
+  while (display.isBusy()) {
+    display.pollDisplay();
+    emu_advance_us(1000);
+  }
+  display._epd.WaitTransfer();
+}
+
+static void save_plane1(void) {
+  for (int y = 0; y < EMU_PANEL_ROWS; y++) {
+    for (int x = 0; x < EMU_PANEL_BYTES; x++) {
+      before[y][x] = emu_ram(1, y, x);
+    }
+  }
+}
+
+static bool plane1_unchanged(const Rows& rows) {
+  for (int y = rows.y0; y <= rows.y1; y++) {
+    for (int x = 0; x < EMU_PANEL_BYTES; x++) {
+      if (emu_ram(1, y, x) != before[y][x]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static bool planes_match(const Rows& rows) {
+  for (int y = rows.y0; y <= rows.y1; y++) {
+    for (int x = 0; x < EMU_PANEL_BYTES; x++) {
+      if (emu_ram(0, y, x) != emu_ram(1, y, x)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Enters a layout from whatever is on screen and checks its labels
+// before and after the refresh that draws them
+static void check_entry(const char* name, const Rows* labels, int count) {
+  save_plane1();
+  display.updateDisplay();
+  CHECK(display.isBusy());
+  display._epd.WaitTransfer();
+  for (int i = 0; i < count; i++) {
+    if (!CHECK(plane1_unchanged(labels[i])) || !CHECK(!planes_match(labels[i]))) {
+      printf("%s: label rows %d-%d\n", name, labels[i].y0, labels[i].y1);
+    }
+  }
+  wait_idle();
+  for (int i = 0; i < count; i++) {
+    CHECK(planes_match(labels[i]));
+  }
+}
+
+int main(void) {
+  display.panelPower.config.sleepAfterMs = 0;
+  display.refreshPolicy.config.maxPartials = 1000;
+  display.refreshPolicy.config.maxArea = 0xFFFFFFFFUL;
+  display.refreshPolicy.config.maxAgeMs = 0xFFFFFFFFUL;
+
+  display.initDisplay();
+  wait_idle();
+  display.showGreeting();
+  wait_idle();
+
+  canary.co2 = 612;
+  check_entry("greeting to readings", READINGS_LABELS, 5);
+
+  // A value update leaves the labels alone
+  save_plane1();
+  canary.co2 = 655;
+  display.updateDisplay();
+  wait_idle();
+  CHECK_EQ(display.stats.fieldsSkipped, FIELD_COUNT - 1);
+  for (int i = 0; i < 5; i++) {
+    CHECK(plane1_unchanged(READINGS_LABELS[i]));
+    CHECK(planes_match(READINGS_LABELS[i]));
+  }
+
+  display.setLayout(LAYOUT_LARGE_CO2);
+  check_entry("large co2 layout", LARGE_CO2_LABELS, 3);
+
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_static_layer");
+}
@@ -0,0 +1,194 @@
+// EpdTransport through the host backend. A block goes out in order, in
+// bursts of at most bus.maxBurst bytes with one bus transaction each.
+// The band buffer being sent may be reused once Busy() is false, and
+// the next upload waits for that. A background upload only moves on
+// when it is polled.
+#include <stdio.h>
+#include <string.h>
+#include <SPI.h>
+#include "epd2in9_V2.h"
+#include "emu.h"
+#include "testing.h"
+
+#define ROW_BYTES (EPD_WIDTH / 8)
+#define FRAME_BYTES (ROW_BYTES * EPD_HEIGHT)
+#define BAND_ROWS 32
+#define BAND_BYTES (ROW_BYTES * BAND_ROWS)
+#define MAX_CHUNKS 64
+
+// The host backend, noting down each burst it starts
+class RecordingTransport : public EpdHostTransport {
+public:
+  RecordingTransport() : EpdHostTransport(EPD_SPI_CLOCK) {}
+  const unsigned char* starts[MAX_CHUNKS];
+  unsigned int lens[MAX_CHUNKS];
+  int chunks = 0;
+  int unowned = 0;              // bursts started without the panel holding the bus
+
+protected:
+  void StartChunk(const unsigned char* data, unsigned int len) {
+    if (chunks < MAX_CHUNKS) {
+      starts[chunks] = data;
+      lens[chunks] = len;
+    }
+    chunks++;
+    if (spiBus.owner() != &EpdIf::bus) {
+      unowned++;
+    }
+    EpdHostTransport::StartChunk(data, len);
+  }
+};
+
+static RecordingTransport transport;
+static SpiBusClient other(SPISettings(4000000, MSBFIRST, SPI_MODE0), 0);
+static unsigned char frame[FRAME_BYTES];
+
+static void fill(unsigned char* buf, int len, int seed) {
+  for (int i = 0; i < len; i++) {
+    buf[i] = (i * 37 + seed) ^ (i >> 5);
+  }
+}
+
+static bool ram_matches(const unsigned char* buf, int y, int rows) {
+  for (int j = 0; j < rows; j++) {
+    for (int x = 0; x < ROW_BYTES; x++) {
+      if (emu_ram(0, y + j, x) != buf[j * ROW_BYTES + x]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Another client takes the bus, so the panel driver has to acquire it
+static void release_panel(void) {
+  spiBus.acquire(other);
+  spiBus.release(other);
+}
+
+static void check_bursts(Epd& epd, unsigned int maxBurst) {
+  EpdIf::bus.maxBurst = maxBurst;
+  fill(frame, FRAME_BYTES, maxBurst);
+  release_panel();
+  transport.chunks = 0;
+  transport.unowned = 0;
+  unsigned long transactions = emu.transactions;
+  unsigned long bursts = EpdIf::bus.stats.bursts;
+
+  epd.SetFrameMemory(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+  transport.Wait();
+
+  int expected = maxBurst ? (FRAME_BYTES + maxBurst - 1) / maxBurst : 1;
+  CHECK_EQ(transport.chunks, expected);
+  CHECK_EQ(transport.unowned, 0);
+  // The commands before the block take the bus and the first burst keeps it
+  CHECK_EQ(emu.transactions - transactions, expected);
+  CHECK_EQ(EpdIf::bus.stats.bursts - bursts, expected);
+
+  unsigned int sent = 0;
+  for (int i = 0; i < transport.chunks && i < MAX_CHUNKS; i++) {
+    unsigned int len = FRAME_BYTES - sent;
+    if (maxBurst && len > maxBurst) {
+      len = maxBurst;
+    }
+    CHECK(transport.starts[i] == frame + sent);
+    CHECK_EQ(transport.lens[i], len);
+    sent += transport.lens[i];
+  }
+  CHECK_EQ(sent, FRAME_BYTES);
+  CHECK(ram_matches(frame, 0, EPD_HEIGHT));
+}
+
+// Bands drawn into two buffers in turn, as CanaryDisplay::nextBand()
+// does: each buffer is refilled while the other one is on the wire
+static void check_double_buffer(Epd& epd) {
+  static unsigned char band[2][BAND_BYTES];
+  EpdIf::bus.maxBurst = EPD_SPI_BURST;
+
+  // The model reads a burst when it completes, so a buffer changed
+  // too early shows in panel RAM
+  fill(band[0], BAND_BYTES, 1);
+  epd.SetFrameMemory(band[0], 0, 0, EPD_WIDTH, BAND_ROWS);
+  CHECK(transport.Busy());
+  memset(band[0], 0xA5, BAND_BYTES);
+  transport.Wait();
+  CHECK(ram_matches(band[0], 0, BAND_ROWS));
+
+  // Changed after Epd::WaitTransfer(), the buffer has already gone out
+  fill(band[0], BAND_BYTES, 2);
+  fill(band[1], BAND_BYTES, 2);
+  epd.SetFrameMemory(band[0], 0, 0, EPD_WIDTH, BAND_ROWS);
+  epd.WaitTransfer();
+  CHECK(!transport.Busy());
+  memset(band[0], 0xA5, BAND_BYTES);
+  CHECK(ram_matches(band[1], 0, BAND_ROWS));
+
+  int b = 0;
+  for (int y = 0; y + BAND_ROWS <= EPD_HEIGHT; y += BAND_ROWS) {
+    fill(band[b], BAND_BYTES, y);
+    epd.SetFrameMemory(band[b], 0, y, EPD_WIDTH, BAND_ROWS);
+    // Starting this band finished the last, whose buffer is next
+    if (y > 0) {
+      CHECK(ram_matches(band[b ^ 1], y - BAND_ROWS, BAND_ROWS));
+    }
+    CHECK(transport.Busy());
+    b ^= 1;
+  }
+  transport.Wait();
+  b = 0;
+  for (int y = 0; y + BAND_ROWS <= EPD_HEIGHT; y += BAND_ROWS) {
+    fill(band[b], BAND_BYTES, y);
+    CHECK(ram_matches(band[b], y, BAND_ROWS));
+    b ^= 1;
+  }
+}
+
+// Nothing happens between polls: each Busy() after a burst's wire time
+// moves on by exactly one burst
+static void check_polled(Epd& epd) {
+  const unsigned int burst = 256;
+  EpdIf::bus.maxBurst = burst;
+  fill(frame, FRAME_BYTES, 7);
+  epd.SetFrameMemory(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+  transport.Wait();
+  fill(frame, FRAME_BYTES, 8);
+  transport.chunks = 0;
+
+  epd.SetFrameMemory(frame, 0, 0, EPD_WIDTH, EPD_HEIGHT);
+  unsigned long ram = emu.ramBytes;
+  emu_advance_us(100000);
+  CHECK_EQ(transport.chunks, 1);
+  CHECK_EQ(emu.ramBytes, ram);
+
+  int n = (FRAME_BYTES + burst - 1) / burst;
+  for (int i = 1; i < n; i++) {
+    CHECK(transport.Busy());
+    CHECK_EQ(transport.chunks, i + 1);
+    CHECK_EQ(emu.ramBytes - ram, i * burst);
+    // Polled again straight away, the new burst is still on the wire
+    CHECK(transport.Busy());
+    CHECK_EQ(transport.chunks, i + 1);
+    emu_advance_us(1000);
+  }
+  CHECK(!transport.Busy());
+  CHECK_EQ(emu.ramBytes - ram, FRAME_BYTES);
+  CHECK(ram_matches(frame, 0, EPD_HEIGHT));
+}
+
+int main(void) {
+  EpdIf::transport = &transport;
+  Epd epd;
+  CHECK_EQ(epd.Init(), 0);
+  epd.WaitUntilIdle();
+
+  check_bursts(epd, EPD_SPI_BURST);
+  check_bursts(epd, 100);
+  check_bursts(epd, FRAME_BYTES);
+  check_bursts(epd, 0);
+  check_double_buffer(epd);
+  check_polled(epd);
+
+  EpdIf::bus.maxBurst = EPD_SPI_BURST;
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_transport");
+}
@@ -0,0 +1,101 @@
+// Waveform selection by temperature, built with EPD_TEMPERATURE_BANDS.
+// The temperature steps through each band edge and back. The band only
+// changes a degree past its edge, and a partial update loads the LUT
+// (0x32) only when the band has changed. Bands are told apart by the
+// first phase length of the LUT, which each one stretches or cuts.
+#include <stdio.h>
+#include "epd2in9_V2.h"
+#include "emu.h"
+#include "testing.h"
+
+#if !EPD_TEMPERATURE_BANDS
+#error build with -DEPD_TEMPERATURE_BANDS=1
+#endif
+
+enum { COLD, COOL, ROOM, WARM, BANDS };
+
+static const char* band_names[BANDS] = {"cold", "cool", "room", "warm"};
+
+// Byte 60 of each band's LUT: the first phase length
+static const uint8_t PARTIAL_PHASE[BANDS] = {0x14, 0x0F, 0x0A, 0x08};
+static const uint8_t FULL_PHASE[BANDS] = {0x28, 0x1E, 0x14, 0x0F};
+
+static unsigned long lut_loads = 0;
+static int lut_byte = -1;
+static uint8_t lut_phase = 0;
+
+static void on_command(uint8_t command) {
+  if (command == 0x32) {
+    lut_loads++;
+    lut_byte = 0;
+  } else {
+    lut_byte = -1;
+  }
+}
+
+static void on_data(uint8_t data) {
+  if (lut_byte >= 0 && lut_byte++ == 60) {
+    lut_phase = data;
+  }
+}
+
+static int band_of(const uint8_t* phases, uint8_t phase) {
+  for (int b = 0; b < BANDS; b++) {
+    if (phases[b] == phase) {
+      return b;
+    }
+  }
+  return -1;
+}
+
+struct Step {
+  int celsius;
+  int band;
+};
+
+// Edges at 10, 20 and 26 C, with a degree either side
+static const Step steps[] = {
+  {22, ROOM}, {26, ROOM}, {27, WARM}, {26, WARM}, {25, WARM}, {24, ROOM},
+  {20, ROOM}, {19, ROOM}, {18, COOL}, {19, COOL}, {20, COOL}, {21, ROOM},
+  {18, COOL}, {10, COOL}, {9, COOL}, {8, COLD}, {10, COLD}, {11, COOL},
+  {30, WARM}, {-5, COLD},
+};
+
+static unsigned char window[EPD_WIDTH / 8 * 16];
+
+int main(void) {
+  emu_hooks.command = on_command;
+  emu_hooks.data = on_data;
+
+  Epd epd;
+  CHECK_EQ(epd.Init(), 0);
+  CHECK_EQ(band_of(FULL_PHASE, lut_phase), ROOM);
+
+  int band = -1;
+  for (unsigned int i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+    const Step& s = steps[i];
+    epd.SetTemperature(s.celsius);
+    unsigned long loads = lut_loads;
+    epd.BeginPartial();
+    epd.SetFrameMemory_Partial(window, 0, 0, EPD_WIDTH, 16);
+    epd.DisplayFrame_Partial();
+    unsigned long sent = lut_loads - loads;
+    int loaded = band_of(PARTIAL_PHASE, lut_phase);
+    printf("%4d C  %-4s  %lu LUT load%s\n", s.celsius, band_names[loaded], sent, sent == 1 ? "" : "s");
+    if (!CHECK_EQ(loaded, s.band)) {
+      printf("  at %d C\n", s.celsius);
+    }
+    CHECK_EQ(sent, s.band != band ? 1 : 0);
+    band = s.band;
+  }
+
+  // A full update loads the full LUT of the band
+  epd.Init();
+  CHECK_EQ(band_of(FULL_PHASE, lut_phase), COLD);
+  epd.SetTemperature(22);
+  epd.Init();
+  CHECK_EQ(band_of(FULL_PHASE, lut_phase), ROOM);
+
+  CHECK_EQ(emu_errors(), 0);
+  return test_result("test_waveforms");
+}
@@ -1,302 +1,110 @@
 #include "tombstone.h"
 #include <avr/pgmspace.h>
 
+// 'tombstone-screen', 128x296px, PackBits: 1649 bytes (4736 raw)
 const unsigned char TOMBSTONE[] PROGMEM = {
-// 'tombstone-screen', 128x296px
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0x7c, 0x03, 0xff, 0x80, 0x7f, 0xff,
-0xff, 0xe0, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3c, 0x00, 0x01, 0xfe, 0x00, 0x3f, 0xff,
-0xff, 0xc0, 0x1e, 0x0f, 0xfe, 0x3f, 0xff, 0x3f, 0x80, 0x3c, 0x00, 0x00, 0xf8, 0x00, 0x1f, 0xff,
-0xff, 0xc0, 0x1c, 0x03, 0xfc, 0x0f, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-0xff, 0xc0, 0x00, 0x00, 0x20, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff,
-0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc3, 0xfe, 0x07, 0xff, 0xc0, 0x00, 0x1f, 0xff,
-0xff, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe3, 0xff, 0x07, 0xff, 0xe0, 0x30, 0x0f, 0xff,
-0xfe, 0x00, 0x38, 0x0f, 0xe0, 0x00, 0x07, 0xff, 0xe3, 0xff, 0x0f, 0xff, 0xe0, 0x30, 0x0f, 0xff,
-0xfc, 0x00, 0x38, 0x1f, 0xfe, 0x08, 0x0f, 0xff, 0xe7, 0xff, 0x0f, 0xff, 0xe0, 0x70, 0x07, 0xff,
-0xfc, 0x00, 0x78, 0x3f, 0xfe, 0x18, 0x0f, 0xff, 0xe7, 0xff, 0x8f, 0xff, 0xe0, 0x70, 0x23, 0xff,
-0xfc, 0x00, 0xf8, 0x7f, 0xff, 0x38, 0x1f, 0xff, 0xe7, 0xff, 0x8f, 0xff, 0xec, 0xf0, 0x39, 0xff,
-0xfc, 0x01, 0xf8, 0xff, 0xff, 0x78, 0x1f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xfc, 0xf0, 0x1f, 0xff,
-0xfc, 0x01, 0xf9, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xfd, 0xf0, 0x1f, 0xff,
-0xfc, 0x01, 0xf9, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xfd, 0xf0, 0x0f, 0xff,
-0xfc, 0x01, 0xf9, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-0xfc, 0xc1, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf6, 0x0f, 0xff,
-0xfe, 0xc1, 0xf9, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x87, 0xff,
-0xfe, 0xe1, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc7, 0xff,
-0xfe, 0xe1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff,
-0xfe, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfb, 0xff,
-0xff, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0x9c, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0x8c, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-0xff, 0xfc, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0xcc, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-0xff, 0xfc, 0x7e, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0xe7, 0xc4, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfe, 0x3e, 0x3f, 0xff, 0xff, 0xff, 0xc1, 0xe7, 0x81, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfe, 0x3e, 0x3f, 0xff, 0xff, 0xff, 0x01, 0xcf, 0x01, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfe, 0x7c, 0x7f, 0xff, 0xff, 0xfe, 0x39, 0xce, 0x79, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfc, 0x7c, 0x7f, 0xff, 0xff, 0xfe, 0x79, 0xcc, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfc, 0x78, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xcc, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0x73, 0xcc, 0xf3, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x03, 0x9c, 0x33, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x03, 0x9e, 0x03, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf9, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
-0xff, 0xf8, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xfc, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-0xff, 0xfc, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff,
-0xff, 0xfc, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xfe, 0x7f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xfe, 0x7f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xfe, 0x7f, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xfe, 0x3f, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xff, 0x3f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xbf, 0xff, 0xef, 0xff, 0xff,
-0xff, 0xff, 0x3f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xbf, 0xf0, 0x0f, 0xff, 0xff,
-0xff, 0xff, 0x1f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x7f, 0xf0, 0x0f, 0xff, 0xff,
-0xff, 0xff, 0x8f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0x7f, 0xf8, 0x7f, 0xff, 0xff,
-0xff, 0xff, 0xc7, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xc3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xe3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfb, 0xff, 0xf9, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xe3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf3, 0xff, 0xfd, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xe3, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x80, 0xcf, 0xfd, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x38, 0x1f, 0xfd, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf3, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf1, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf0, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xf8, 0x7f, 0x87, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xfc, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x0f, 0xe1, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0x87, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xf7, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xc3, 0xf8, 0x7f, 0xff, 0xff, 0xfc, 0x3f, 0xef, 0xf0, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xe1, 0xfc, 0x3f, 0xff, 0xff, 0xf8, 0x7f, 0xcf, 0xe1, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xf0, 0xfe, 0x1f, 0xff, 0xc0, 0x00, 0x3f, 0x1f, 0xc3, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfc, 0x3f, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x0f, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xfe, 0x1f, 0x87, 0xfe, 0x1f, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0x87, 0xc3, 0xfc, 0x7f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xc1, 0xe1, 0xf8, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xf0, 0x70, 0xf1, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xfc, 0x38, 0x63, 0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3e, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x90, 0xff, 0x00, 0xf1, 0xf9, 0xff, 0x03, 0xfe, 0x07, 0xff, 0xfb, 0xfe, 0xff, 0x01, 0xe0, 0x7f,
+	0xfc, 0xff, 0x0b, 0xe0, 0x7f, 0x7c, 0x03, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xe0, 0x3f, 0x3f, 0xfd,
+	0xff, 0x1f, 0xc0, 0x3c, 0x00, 0x01, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x1e, 0x0f, 0xfe, 0x3f,
+	0xff, 0x3f, 0x80, 0x3c, 0x00, 0x00, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x1c, 0x03, 0xfc, 0x0f,
+	0xfe, 0x0f, 0xfb, 0x00, 0x08, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x20, 0x03, 0xfc, 0xfa, 0x00,
+	0x03, 0x07, 0xff, 0xff, 0xc0, 0xfd, 0x00, 0x00, 0xf8, 0xfa, 0x00, 0x03, 0x07, 0xff, 0xff, 0x80,
+	0xf5, 0x00, 0x02, 0x33, 0xff, 0xff, 0xfc, 0x00, 0x0c, 0x03, 0xff, 0xc3, 0xfe, 0x07, 0xff, 0xc0,
+	0x00, 0x1f, 0xff, 0xff, 0x00, 0x08, 0xfe, 0x00, 0x50, 0x03, 0xff, 0xe3, 0xff, 0x07, 0xff, 0xe0,
+	0x30, 0x0f, 0xff, 0xfe, 0x00, 0x38, 0x0f, 0xe0, 0x00, 0x07, 0xff, 0xe3, 0xff, 0x0f, 0xff, 0xe0,
+	0x30, 0x0f, 0xff, 0xfc, 0x00, 0x38, 0x1f, 0xfe, 0x08, 0x0f, 0xff, 0xe7, 0xff, 0x0f, 0xff, 0xe0,
+	0x70, 0x07, 0xff, 0xfc, 0x00, 0x78, 0x3f, 0xfe, 0x18, 0x0f, 0xff, 0xe7, 0xff, 0x8f, 0xff, 0xe0,
+	0x70, 0x23, 0xff, 0xfc, 0x00, 0xf8, 0x7f, 0xff, 0x38, 0x1f, 0xff, 0xe7, 0xff, 0x8f, 0xff, 0xec,
+	0xf0, 0x39, 0xff, 0xfc, 0x01, 0xf8, 0xff, 0xff, 0x78, 0x1f, 0xfe, 0xff, 0x0c, 0x8f, 0xff, 0xfc,
+	0xf0, 0x1f, 0xff, 0xfc, 0x01, 0xf9, 0xff, 0xff, 0xf8, 0x3f, 0xfe, 0xff, 0x0c, 0x8f, 0xff, 0xfd,
+	0xf0, 0x1f, 0xff, 0xfc, 0x01, 0xf9, 0xff, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0x0c, 0xcf, 0xff, 0xfd,
+	0xf0, 0x0f, 0xff, 0xfc, 0x01, 0xf9, 0xff, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0x0b, 0xdf, 0xff, 0xff,
+	0xf0, 0x0f, 0xff, 0xfc, 0xc1, 0xf9, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0x0b, 0xdf, 0xff, 0xff, 0xf6,
+	0x0f, 0xff, 0xfe, 0xc1, 0xf9, 0xff, 0xff, 0xfc, 0xfa, 0xff, 0x08, 0xf7, 0x87, 0xff, 0xfe, 0xe1,
+	0xf9, 0xff, 0xff, 0xfd, 0xfa, 0xff, 0x05, 0xf7, 0xc7, 0xff, 0xfe, 0xe1, 0xf9, 0xf7, 0xff, 0xff,
+	0xf7, 0x03, 0xff, 0xfe, 0xf1, 0xf9, 0xf7, 0xff, 0x05, 0xf7, 0xfb, 0xff, 0xff, 0xf1, 0xf9, 0xf7,
+	0xff, 0x00, 0xf7, 0xfe, 0xff, 0x01, 0xf1, 0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0x01, 0xf1,
+	0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0x01, 0xf1, 0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff,
+	0x01, 0xf1, 0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xf3, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0xff, 0xf9, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb,
+	0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff,
+	0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8,
+	0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01,
+	0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xfd, 0xff, 0x02,
+	0xfc, 0xe7, 0x3c, 0xfe, 0xff, 0x00, 0xf9, 0xfe, 0xff, 0x02, 0xf9, 0xfc, 0x7f, 0xfe, 0xff, 0x02,
+	0xfc, 0xe7, 0x9c, 0xfe, 0xff, 0x00, 0xf9, 0xfe, 0xff, 0x02, 0xf9, 0xfc, 0x7f, 0xfe, 0xff, 0x02,
+	0xfc, 0xe7, 0x8c, 0xfe, 0xff, 0x00, 0xf9, 0xfe, 0xff, 0x02, 0xfc, 0xfe, 0x3f, 0xfe, 0xff, 0x02,
+	0xfc, 0xe7, 0xcc, 0xfe, 0xff, 0x00, 0xf9, 0xfe, 0xff, 0x02, 0xfc, 0x7e, 0x3f, 0xfe, 0xff, 0x02,
+	0xfc, 0xe7, 0xc4, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x02, 0xfe, 0x3e, 0x3f, 0xfe, 0xff, 0x02,
+	0xc1, 0xe7, 0x81, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x02, 0xfe, 0x3e, 0x3f, 0xfe, 0xff, 0x02,
+	0x01, 0xcf, 0x01, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x08, 0xfe, 0x7c, 0x7f, 0xff, 0xff, 0xfe,
+	0x39, 0xce, 0x79, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x08, 0xfc, 0x7c, 0x7f, 0xff, 0xff, 0xfe,
+	0x79, 0xcc, 0xf9, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x01, 0xfc, 0x78, 0xfe, 0xff, 0x03, 0xfc,
+	0xf9, 0xcc, 0xf9, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x01, 0xfc, 0xf8, 0xfe, 0xff, 0x03, 0xfc,
+	0x73, 0xcc, 0xf3, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x03, 0xfe, 0x03,
+	0x9c, 0x33, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0x03, 0xfe, 0x03, 0x9e,
+	0x03, 0xfe, 0xff, 0x00, 0xfd, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfd, 0xfe, 0xff,
+	0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xe1, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0x3f,
+	0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0x3f, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff,
+	0x00, 0xcf, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0x01, 0xf9, 0xf8,
+	0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xf8, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01,
+	0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00,
+	0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7,
+	0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9,
+	0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff,
+	0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb,
+	0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff,
+	0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc,
+	0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01,
+	0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe,
+	0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00,
+	0xfb, 0xfe, 0xff, 0x01, 0xf9, 0xfc, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x02, 0xf9, 0xfc, 0x7f,
+	0xf8, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x02, 0xf8, 0xfc, 0x7f, 0xf8, 0xff, 0x00, 0xf7, 0xfe, 0xff,
+	0x02, 0xfc, 0xfe, 0x7f, 0xf8, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0x02, 0xfc, 0xfe, 0x3f, 0xf8, 0xff,
+	0x00, 0xe7, 0xfe, 0xff, 0x02, 0xfc, 0xfe, 0x3f, 0xf8, 0xff, 0x00, 0xef, 0xfe, 0xff, 0x02, 0xfe,
+	0x7f, 0x1f, 0xfd, 0xff, 0x00, 0xfb, 0xfd, 0xff, 0x00, 0xef, 0xfe, 0xff, 0x02, 0xfe, 0x7f, 0x1f,
+	0xfd, 0xff, 0x00, 0xfb, 0xfd, 0xff, 0x00, 0xef, 0xfe, 0xff, 0x02, 0xfe, 0x7f, 0x9f, 0xfd, 0xff,
+	0x05, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xef, 0xfe, 0xff, 0x02, 0xfe, 0x3f, 0x8f, 0xfd, 0xff, 0x00,
+	0xf9, 0xfd, 0xff, 0x00, 0xef, 0xfd, 0xff, 0x01, 0x3f, 0xcf, 0xfd, 0xff, 0x05, 0xf8, 0xff, 0xff,
+	0xbf, 0xff, 0xef, 0xfd, 0xff, 0x01, 0x3f, 0xc7, 0xfd, 0xff, 0x05, 0xf0, 0x7f, 0xff, 0xbf, 0xf0,
+	0x0f, 0xfd, 0xff, 0x01, 0x1f, 0xc7, 0xfd, 0xff, 0x05, 0xfc, 0x3f, 0xff, 0x7f, 0xf0, 0x0f, 0xfd,
+	0xff, 0x01, 0x8f, 0xe7, 0xfc, 0xff, 0x04, 0x3f, 0xfe, 0x7f, 0xf8, 0x7f, 0xfd, 0xff, 0x01, 0xc7,
+	0xe3, 0xfc, 0xff, 0x03, 0x9f, 0xfe, 0xff, 0xfb, 0xfc, 0xff, 0x01, 0xc3, 0xf3, 0xfc, 0xff, 0x03,
+	0xcf, 0xfd, 0xff, 0xfb, 0xfc, 0xff, 0x01, 0xe3, 0xf1, 0xfc, 0xff, 0x03, 0xcf, 0xfb, 0xff, 0xf9,
+	0xfc, 0xff, 0x01, 0xe3, 0xf1, 0xfc, 0xff, 0x03, 0xef, 0xf3, 0xff, 0xfd, 0xfc, 0xff, 0x01, 0xe3,
+	0xf9, 0xfc, 0xff, 0x03, 0xef, 0x80, 0xcf, 0xfd, 0xfc, 0xff, 0x01, 0xf3, 0xf8, 0xfc, 0xff, 0x03,
+	0xe6, 0x38, 0x1f, 0xfd, 0xfc, 0xff, 0x01, 0xf3, 0xf8, 0xfc, 0xff, 0x03, 0xe6, 0x7f, 0xff, 0xfc,
+	0xfc, 0xff, 0x02, 0xf3, 0xfc, 0x7f, 0xfd, 0xff, 0x03, 0xe4, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0x02,
+	0xf1, 0xfc, 0x3f, 0xfd, 0xff, 0x03, 0xe1, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0x02, 0xf0, 0xfe, 0x1f,
+	0xfd, 0xff, 0x03, 0xe1, 0xff, 0xff, 0xe3, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0x0f, 0xfd, 0xff, 0x03,
+	0xe3, 0xff, 0xff, 0xc7, 0xfc, 0xff, 0x02, 0xf8, 0x7f, 0x87, 0xfd, 0xff, 0x03, 0xc7, 0xff, 0xff,
+	0x8f, 0xfc, 0xff, 0x02, 0xfc, 0x3f, 0xc3, 0xfd, 0xff, 0x03, 0x8f, 0xff, 0xff, 0x1f, 0xfb, 0xff,
+	0x01, 0x0f, 0xe1, 0xfe, 0xff, 0x04, 0xfe, 0x0f, 0xff, 0xfe, 0x3f, 0xfb, 0xff, 0x01, 0x87, 0xf0,
+	0xfe, 0xff, 0x04, 0xfc, 0x1f, 0xf7, 0xfc, 0x7f, 0xfb, 0xff, 0x08, 0xc3, 0xf8, 0x7f, 0xff, 0xff,
+	0xfc, 0x3f, 0xef, 0xf0, 0xfa, 0xff, 0x08, 0xe1, 0xfc, 0x3f, 0xff, 0xff, 0xf8, 0x7f, 0xcf, 0xe1,
+	0xfa, 0xff, 0x08, 0xf0, 0xfe, 0x1f, 0xff, 0xc0, 0x00, 0x3f, 0x1f, 0xc3, 0xfa, 0xff, 0x03, 0xfc,
+	0x3f, 0x0f, 0xff, 0xfe, 0x00, 0x01, 0x7f, 0x0f, 0xfa, 0xff, 0x08, 0xfe, 0x1f, 0x87, 0xfe, 0x1f,
+	0xff, 0xff, 0xfe, 0x1f, 0xf9, 0xff, 0x07, 0x87, 0xc3, 0xfc, 0x7f, 0xff, 0xff, 0xf8, 0x3f, 0xf9,
+	0xff, 0x02, 0xc1, 0xe1, 0xf8, 0xfe, 0xff, 0x00, 0xe0, 0xf8, 0xff, 0x02, 0xf0, 0x70, 0xf1, 0xfe,
+	0xff, 0x00, 0x81, 0xf8, 0xff, 0x06, 0xfc, 0x38, 0x63, 0xff, 0xff, 0xfe, 0x07, 0xf8, 0xff, 0x06,
+	0xfe, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x1f, 0xf7, 0xff, 0x05, 0x80, 0x07, 0xff, 0xff, 0xc0, 0x7f,
+	0xf7, 0xff, 0x04, 0xf0, 0x07, 0xff, 0xfc, 0x01, 0xf6, 0xff, 0x04, 0xfc, 0x00, 0x3e, 0x00, 0x0f,
+	0xf5, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x7f, 0xf5, 0xff, 0x02, 0xfc, 0x00, 0x07, 0x81, 0xff, 0x81,
+	0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81,
+	0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0xaa,
+	0xff,
 };
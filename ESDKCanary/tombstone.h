@@ -23,6 +23,7 @@
  * THE SOFTWARE.
  */
 
+// PackBits compressed, see tools/imgpack.py
 extern const unsigned char TOMBSTONE[];
 
 /* FILE END */
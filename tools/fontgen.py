@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Generate rotated and subsetted copies of the ESDKCanary font tables.
+
+Reads the sFONT tables in ESDKCanary/fontNN.cpp and writes a single
+.cpp file with a copy of each requested font. A font can be turned
+upside down, so Paint can copy glyph rows straight into the image when
+its rotation matches, and cut down to a declared character set.
+
+A subset font carries a 95 byte index from ASCII to glyph slot. Chars
+that are not in the set draw nothing, like space, so space never needs
+to be listed.
+
+With --trim each glyph is cut to its bounding box and described by an
+sGLYPH (offset, left, top, width, height), which drops the empty rows
+and columns around it at a cost of 6 bytes per glyph. Use --stats to
+compare the sizes before choosing.
+
+    tools/fontgen.py --rotate 180 -o ESDKCanary/fonts_rot180.cpp \\
+        24:CO2TEMPRHV 20:0123456789.%CpmPM 16
+
+Run it again whenever a source font or a string on the display
+changes; the output is checked in and records the command that made it.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FONT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "ESDKCanary")
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+NO_GLYPH = 0xFF
+
+
+GLYPH_SIZE = 6  # sizeof(sGLYPH)
+
+
+class Font:
+    def __init__(self, name, width, height, chars, glyphs, subset=False):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.chars = chars    # char code of each glyph slot
+        self.glyphs = glyphs  # one list of rows per slot, rows are ints MSB first
+        self.subset = subset
+
+    @property
+    def row_bytes(self):
+        return (self.width + 7) // 8
+
+    def bbox(self, slot):
+        """(left, top, width, height) of the set pixels, all 0 if blank."""
+        bits = self.row_bytes * 8
+        rows = self.glyphs[slot]
+        used = [j for j, row in enumerate(rows) if row]
+        if not used:
+            return 0, 0, 0, 0
+        cols = 0
+        for row in rows:
+            cols |= row
+        left = bits - cols.bit_length()
+        right = bits - 1 - ((cols & -cols).bit_length() - 1)
+        return left, used[0], right - left + 1, used[-1] - used[0] + 1
+
+    def trimmed_rows(self, slot):
+        """The bounding box rows, each MSB aligned to its own byte count."""
+        left, top, width, height = self.bbox(slot)
+        nbytes = (width + 7) // 8
+        shift = self.row_bytes * 8 - left - nbytes * 8
+        out = []
+        for row in self.glyphs[slot][top:top + height]:
+            out.append(row >> shift if shift >= 0 else row << -shift)
+        return out, nbytes
+
+    def table_size(self, trim=False):
+        if not trim:
+            return len(self.glyphs) * self.height * self.row_bytes
+        total = 0
+        for slot in range(len(self.glyphs)):
+            rows, nbytes = self.trimmed_rows(slot)
+            total += len(rows) * nbytes
+        return total
+
+    def flash_size(self, trim=False):
+        size = self.table_size(trim)
+        if trim:
+            size += len(self.glyphs) * GLYPH_SIZE
+        if self.subset:
+            size += LAST_CHAR - FIRST_CHAR + 1
+        return size
+
+
+def load_font(size):
+    path = os.path.join(FONT_DIR, "font%d.cpp" % size)
+    with open(path) as f:
+        src = f.read()
+    table = re.search(r"Font%d_Table\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};" % size, src, re.S)
+    desc = re.search(r"sFONT\s+Font%d\s*=\s*\{\s*Font%d_Table\s*,\s*(\d+)\s*,\s*(\d+)" % (size, size),
+                     re.sub(r"/\*.*?\*/", "", src, flags=re.S))
+    if not table or not desc:
+        sys.exit("%s: no Font%d table" % (path, size))
+    width, height = int(desc.group(1)), int(desc.group(2))
+    data = [int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"//.*", "", table.group(1)))]
+    row_bytes = (width + 7) // 8
+    chars = list(range(FIRST_CHAR, LAST_CHAR + 1))
+    if len(data) != len(chars) * height * row_bytes:
+        sys.exit("%s: expected %d bytes, found %d" % (path, len(chars) * height * row_bytes, len(data)))
+    glyphs = []
+    for c in range(len(chars)):
+        rows = []
+        for j in range(height):
+            off = (c * height + j) * row_bytes
+            row = 0
+            for k in range(row_bytes):
+                row = (row << 8) | data[off + k]
+            rows.append(row)
+        glyphs.append(rows)
+    return Font("Font%d" % size, width, height, chars, glyphs)
+
+
+def rotate180(font):
+    """Turn every glyph upside down inside its Width x Height cell."""
+    bits = font.row_bytes * 8
+    glyphs = []
+    for rows in font.glyphs:
+        out = []
+        for row in reversed(rows):
+            cell = row >> (bits - font.width)
+            flipped = int(format(cell, "0%db" % font.width)[::-1], 2)
+            out.append(flipped << (bits - font.width))
+        glyphs.append(out)
+    return Font(font.name, font.width, font.height, font.chars, glyphs, font.subset)
+
+
+def subset(font, charset):
+    """Keep only the glyphs for charset, in ASCII order."""
+    codes = sorted(set(ord(ch) for ch in charset) - {ord(" ")})
+    for code in codes:
+        if code not in font.chars:
+            sys.exit("%s has no glyph for %r" % (font.name, chr(code)))
+    glyphs = [font.glyphs[font.chars.index(code)] for code in codes]
+    return Font(font.name, font.width, font.height, codes, glyphs, subset=True)
+
+
+def hex_row(row, nbytes):
+    return ", ".join("0x%02X" % ((row >> (8 * (nbytes - 1 - k))) & 0xFF) for k in range(nbytes))
+
+
+def art_row(row, nbytes, width):
+    return format(row, "0%db" % (nbytes * 8))[:width].replace("0", " ").replace("1", "#").rstrip()
+
+
+def emit(fonts, rotate, suffix, trim, command, out):
+    w = out.write
+    w("/**\n")
+    w(" *  @filename   :   %s\n" % os.path.basename(out.name))
+    w(" *  @brief      :   Fonts for Paint, stored rotated by %d degrees.\n" % rotate)
+    w(" *                  Generated by tools/fontgen.py - do not edit:\n")
+    w(" *                  %s\n" % command)
+    w(" */\n\n")
+    w('#include <avr/pgmspace.h>\n#include "epdpaint.h"\n#include "fonts.h"\n')
+    for font in fonts:
+        rb = font.row_bytes
+        name = font.name + suffix
+        boxes = []
+        offset = 0
+        w("\nconst uint8_t %s_Table[] PROGMEM =\n{\n" % name)
+        for slot, rows in enumerate(font.glyphs):
+            ch = chr(font.chars[slot])
+            if trim:
+                left, top, width, height = font.bbox(slot)
+                rows, nbytes = font.trimmed_rows(slot)
+                boxes.append((offset, left, top, width, height, ch))
+                if not rows:
+                    continue
+            else:
+                nbytes, width = rb, font.width
+            if offset:
+                w("\n")
+            w("\t// @%d '%s' (%d pixels wide)\n" % (offset, ch, width))
+            for row in rows:
+                w("\t%s, //%s\n" % (hex_row(row, nbytes), art_row(row, nbytes, width)))
+            offset += len(rows) * nbytes
+        w("};\n")
+        if trim:
+            w("\n/* offset, left, top, width, height */\n")
+            w("const sGLYPH %s_Glyphs[] PROGMEM =\n{\n" % name)
+            for box in boxes:
+                w("\t{%d, %d, %d, %d, %d}, // '%s'\n" % box)
+            w("};\n")
+        if font.subset:
+            w("\n/* glyph slot for each char from ' ', 0x%02X = not in the font */\n" % NO_GLYPH)
+            w("const uint8_t %s_Index[] PROGMEM =\n{\n" % name)
+            slots = [font.chars.index(c) if c in font.chars else NO_GLYPH
+                     for c in range(FIRST_CHAR, LAST_CHAR + 1)]
+            for i in range(0, len(slots), 16):
+                w("\t%s,\n" % ", ".join("0x%02X" % s for s in slots[i:i + 16]))
+            w("};\n")
+        w("\nsFONT %s = {\n" % name)
+        w("  %s_Table,\n" % name)
+        w("  %d, /* Width */\n" % font.width)
+        w("  %d, /* Height */\n" % font.height)
+        w("  ROTATE_%d, /* Rotate */\n" % rotate)
+        w("  %s,\n" % ("%s_Index" % name if font.subset else "NULL"))
+        if trim:
+            w("  %s_Glyphs,\n" % name)
+        w("};\n")
+    w("\n/* END OF FILE */\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("fonts", nargs="+", metavar="SIZE[:CHARS]",
+                    help="font height, optionally with the chars to keep, e.g. 20:0123456789")
+    ap.add_argument("--rotate", type=int, choices=[0, 180], default=0)
+    ap.add_argument("--suffix", help="name suffix, default _Rot180 or _Subset")
+    ap.add_argument("--trim", action="store_true", help="store each glyph's bounding box only")
+    ap.add_argument("--stats", action="store_true", help="print plain and trimmed sizes, write nothing")
+    ap.add_argument("-o", "--output")
+    args = ap.parse_args()
+    suffix = args.suffix or ("_Rot%d" % args.rotate if args.rotate else "_Subset")
+
+    fonts = []
+    for spec in args.fonts:
+        size, _, charset = spec.partition(":")
+        full = load_font(int(size))
+        font = subset(full, charset) if charset else full
+        if args.rotate == 180:
+            font = rotate180(font)
+        fonts.append(font)
+        if args.stats:
+            print("%s%s: %d glyphs, full %d B, plain %d B, trimmed %d B" % (
+                font.name, suffix, len(font.glyphs), full.flash_size(),
+                font.flash_size(), font.flash_size(trim=True)))
+        else:
+            size = font.flash_size(args.trim)
+            sys.stderr.write("%s%s: %d glyphs, %d bytes (full table %d bytes, saves %d)\n" % (
+                font.name, suffix, len(font.glyphs), size, full.flash_size(), full.flash_size() - size))
+    if args.stats:
+        return
+    if not args.output:
+        ap.error("-o is required")
+
+    command = " ".join(["tools/fontgen.py"] + [a if re.match(r"^[\w./:=-]+$", a) else "'%s'" % a
+                                               for a in sys.argv[1:]])
+    with open(args.output, "w") as out:
+        emit(fonts, args.rotate, suffix, args.trim, command, out)
+
+
+if __name__ == "__main__":
+    main()
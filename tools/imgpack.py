@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Convert a full-screen image to a PackBits PROGMEM array for the 2.9" panel.
+
+The panel RAM is 128 x 296, 16 bytes per row, MSB first, bit set = white.
+Epd::SetFrameMemory_Base_PackBits() streams the packed bytes straight to
+the panel and UnpackBits_P() decodes them into a RAM frame.
+
+Inputs:
+    .pbm            P1 or P4 bitmap (1 = black)
+    .png            8 bit grey/RGB/RGBA/palette or 1 bit, not interlaced;
+                    pixels darker than --threshold are black
+    .c .cpp .h      an existing raw panel array (the first {...} block)
+
+    tools/imgpack.py splash.png -n SPLASH -o ESDKCanary/splash.h
+
+Images must be 128x296 pixels, or 296x128 with --rotate 90/270.
+
+PackBits: a control byte n in 0..127 is followed by n+1 literal bytes,
+n in 129..255 is followed by one byte to repeat 257-n times, 128 is
+unused.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+WIDTH = 128
+HEIGHT = 296
+
+
+def read_pbm(data):
+    tokens = re.sub(rb"#[^\n]*", b"", data[:256]).split()
+    magic = tokens[0]
+    width, height = int(tokens[1]), int(tokens[2])
+    if magic == b"P1":
+        body = re.sub(rb"#[^\n]*", b"", data).split(None, 3)[3]
+        bits = [c == ord("1") for c in body if c in b"01"]
+        return width, height, [[bits[y * width + x] for x in range(width)] for y in range(height)]
+    if magic == b"P4":
+        # header is magic, width, height and one whitespace byte
+        m = re.match(rb"P4\s+(?:#[^\n]*\n\s*)*\d+\s+(?:#[^\n]*\n\s*)*\d+\s", data)
+        raster = data[m.end():]
+        stride = (width + 7) // 8
+        return width, height, [[bool(raster[y * stride + x // 8] & (0x80 >> (x % 8)))
+                                for x in range(width)] for y in range(height)]
+    sys.exit("only P1 and P4 PBM files are supported")
+
+
+def read_png(data, threshold):
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("not a PNG file")
+    pos, idat, palette = 8, b"", None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [chunk[i:i + 3] for i in range(0, len(chunk), 3)]
+        elif kind == b"IDAT":
+            idat += chunk
+        pos += 12 + length
+    if interlace or depth not in (1, 8):
+        sys.exit("PNG must be 1 or 8 bits per sample and not interlaced")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bpp = max(1, channels * depth // 8)
+    stride = (width * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+    pixels = []
+    for line in rows:
+        out = []
+        for x in range(width):
+            if depth == 1:
+                v = 255 if line[x // 8] & (0x80 >> (x % 8)) else 0
+                if ctype == 3:
+                    v = sum(palette[v // 255])
+                    v //= 3
+            elif ctype == 3:
+                v = sum(palette[line[x]]) // 3
+            elif ctype in (0, 4):
+                v = line[x * channels]
+            else:
+                v = sum(line[x * channels:x * channels + 3]) // 3
+            if ctype in (4, 6) and line[x * channels + channels - 1] < 128:
+                v = 255  # transparent is white
+            out.append(v < threshold)
+        pixels.append(out)
+    return width, height, pixels
+
+
+def read_array(text):
+    body = re.search(r"\{(.*?)\}", re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S), re.S)
+    data = [int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", body.group(1))]
+    if len(data) != WIDTH // 8 * HEIGHT:
+        sys.exit("expected %d bytes, found %d" % (WIDTH // 8 * HEIGHT, len(data)))
+    return bytes(data)
+
+
+def rotate(width, height, pixels, degrees):
+    for _ in range(degrees // 90):
+        # clockwise
+        pixels = [[pixels[height - 1 - x][y] for x in range(height)] for y in range(width)]
+        width, height = height, width
+    return width, height, pixels
+
+
+def to_panel(width, height, pixels):
+    if (width, height) != (WIDTH, HEIGHT):
+        sys.exit("image is %dx%d, the panel is %dx%d" % (width, height, WIDTH, HEIGHT))
+    out = bytearray()
+    for row in pixels:
+        for b in range(WIDTH // 8):
+            byte = 0
+            for i in range(8):
+                if not row[b * 8 + i]:
+                    byte |= 0x80 >> i  # bit set = white
+            out.append(byte)
+    return bytes(out)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes([data[i]]) * (257 - n)
+            i += 1
+    return bytes(out[:size])
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("input")
+    ap.add_argument("-n", "--name", required=True, help="C array name")
+    ap.add_argument("-o", "--output", help="write the array here instead of stdout")
+    ap.add_argument("--rotate", type=int, choices=[0, 90, 180, 270], default=0,
+                    help="rotate the source clockwise first")
+    ap.add_argument("--threshold", type=int, default=128)
+    args = ap.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    ext = args.input.rsplit(".", 1)[-1].lower()
+    if ext in ("c", "cpp", "h"):
+        raw = read_array(data.decode())
+    else:
+        if ext == "pbm":
+            width, height, pixels = read_pbm(data)
+        elif ext == "png":
+            width, height, pixels = read_png(data, args.threshold)
+        else:
+            sys.exit("unknown input type .%s" % ext)
+        raw = to_panel(*rotate(width, height, pixels, args.rotate))
+
+    packed = packbits(raw)
+    assert unpackbits(packed, len(raw)) == raw
+    lines = ["// '%s', %dx%dpx, PackBits: %d bytes (%d raw)" % (
+        args.name, WIDTH, HEIGHT, len(packed), len(raw))]
+    lines.append("const unsigned char %s[] PROGMEM = {" % args.name)
+    for i in range(0, len(packed), 16):
+        lines.append("\t" + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    sys.stderr.write("%s: %d -> %d bytes\n" % (args.name, len(raw), len(packed)))
+
+
+if __name__ == "__main__":
+    main()